@@ -16,6 +16,7 @@
 #include "bolt/Core/BinaryFunction.h"
 #include "bolt/Core/DebugData.h"
 #include "bolt/Core/FunctionLayout.h"
+#include "bolt/Core/ParallelUtilities.h"
 #include "bolt/Utils/CommandLineOpts.h"
 #include "bolt/Utils/Utils.h"
 #include "llvm/DebugInfo/DWARF/DWARFCompileUnit.h"
@@ -24,6 +25,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/LEB128.h"
 #include "llvm/Support/SMLoc.h"
+#include "llvm/Support/ThreadPool.h"
 
 #define DEBUG_TYPE "bolt"
 
@@ -221,6 +223,31 @@ void BinaryEmitter::emitAll(StringRef OrgSecPrefix) {
 }
 
 void BinaryEmitter::emitFunctions() {
+  // Emission has to be sequential, but releasing the CFGs of emitted functions
+  // can be done in parallel. Release them in fixed-size batches so that at
+  // most ReleaseBatchSize CFGs are kept alive beyond their emission, which
+  // bounds the extra peak memory. CFGs needed for cache metrics are kept.
+  constexpr size_t ReleaseBatchSize = 1024;
+  std::vector<BinaryFunction *> PendingRelease;
+  auto releaseCFGs = [&]() {
+    if (opts::NoThreads || PendingRelease.size() <= 1) {
+      for (BinaryFunction *BF : PendingRelease)
+        BF->setEmitted();
+    } else {
+      ThreadPool &Pool = ParallelUtilities::getThreadPool();
+      const size_t NumTasks =
+          std::min<size_t>(opts::ThreadCount, PendingRelease.size());
+      for (size_t I = 0; I != NumTasks; ++I) {
+        Pool.async([&, I]() {
+          for (size_t J = I; J < PendingRelease.size(); J += NumTasks)
+            PendingRelease[J]->setEmitted();
+        });
+      }
+      Pool.wait();
+    }
+    PendingRelease.clear();
+  };
+
   auto emit = [&](const std::vector<BinaryFunction *> &Functions) {
     const bool HasProfile = BC.NumProfiledFuncs > 0;
     const bool OriginalAllowAutoPadding = Streamer.getAllowAutoPadding();
@@ -259,8 +286,15 @@ void BinaryEmitter::emitFunctions() {
 
       Streamer.setAllowAutoPadding(OriginalAllowAutoPadding);
 
-      if (Emitted)
-        Function->setEmitted(/*KeepCFG=*/opts::PrintCacheMetrics);
+      if (!Emitted)
+        continue;
+      // The CFG is released with the rest of its batch.
+      Function->setEmitted(/*KeepCFG=*/true);
+      if (opts::PrintCacheMetrics)
+        continue;
+      PendingRelease.push_back(Function);
+      if (PendingRelease.size() == ReleaseBatchSize)
+        releaseCFGs();
     }
   };
 
@@ -282,6 +316,8 @@ void BinaryEmitter::emitFunctions() {
     Streamer.switchSection(BC.getTextSection());
     Streamer.emitLabel(BC.getHotTextEndSymbol());
   }
+
+  releaseCFGs();
 }
 
 bool BinaryEmitter::emitFunction(BinaryFunction &Function,
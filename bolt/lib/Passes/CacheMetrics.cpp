@@ -132,10 +132,8 @@ extractFunctionCalls(const std::vector<BinaryFunction *> &BinaryFunctions) {
 double expectedCacheHitRatio(
     const std::vector<BinaryFunction *> &BinaryFunctions,
     const std::unordered_map<BinaryBasicBlock *, uint64_t> &BBAddr,
-    const std::unordered_map<BinaryBasicBlock *, uint64_t> &BBSize) {
-
-  const double PageSize = opts::ITLBPageSize;
-  const uint64_t CacheEntries = opts::ITLBEntries;
+    const std::unordered_map<BinaryBasicBlock *, uint64_t> &BBSize,
+    uint64_t PageSize, uint64_t CacheEntries) {
   std::unordered_map<const BinaryFunction *, Predecessors> Calls =
       extractFunctionCalls(BinaryFunctions);
   // Compute 'hotness' of the functions
@@ -155,7 +153,7 @@ double expectedCacheHitRatio(
   for (BinaryFunction *BF : BinaryFunctions) {
     if (BF->getLayout().block_empty())
       continue;
-    double Page = BBAddr.at(BF->getLayout().block_front()) / PageSize;
+    uint64_t Page = BBAddr.at(BF->getLayout().block_front()) / PageSize;
     PageSamples[Page] += FunctionSamples.at(BF);
   }
 
@@ -166,14 +164,14 @@ double expectedCacheHitRatio(
     if (BF->getLayout().block_empty() || FunctionSamples.at(BF) == 0.0)
       continue;
     double Samples = FunctionSamples.at(BF);
-    double Page = BBAddr.at(BF->getLayout().block_front()) / PageSize;
+    uint64_t Page = BBAddr.at(BF->getLayout().block_front()) / PageSize;
     // The probability that the page is not present in the cache
     double MissProb = pow(1.0 - PageSamples[Page] / TotalSamples, CacheEntries);
 
     // Processing all callers of the function
     for (std::pair<BinaryFunction *, uint64_t> Pair : Calls[BF]) {
       BinaryFunction *SrcFunction = Pair.first;
-      double SrcPage =
+      uint64_t SrcPage =
           BBAddr.at(SrcFunction->getLayout().block_front()) / PageSize;
       // Is this a 'long' or a 'short' call?
       if (Page != SrcPage) {
@@ -250,7 +248,13 @@ void CacheMetrics::printAll(const std::vector<BinaryFunction *> &BFs) {
   extractBasicBlockInfo(BFs, BBAddr, BBSize);
 
   outs() << "  Expected i-TLB cache hit ratio: "
-         << format("%.2lf%%\n", expectedCacheHitRatio(BFs, BBAddr, BBSize));
+         << format("%.2lf%%\n",
+                   expectedCacheHitRatio(BFs, BBAddr, BBSize,
+                                         opts::ITLBPageSize, opts::ITLBEntries));
+  outs() << "  Expected i-TLB cache hit ratio with 2MB pages: "
+         << format("%.2lf%%\n",
+                   expectedCacheHitRatio(BFs, BBAddr, BBSize, HugePage2MB,
+                                         opts::ITLBEntries));
 
   auto Stats = calcTSPScore(BFs, BBAddr, BBSize);
   outs() << "  TSP score: "
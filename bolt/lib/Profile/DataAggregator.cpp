@@ -193,12 +193,10 @@ void DataAggregator::start() {
                     "script -F pid,event,addr,ip",
                     /*Wait = */false);
 
+  // Read mmap and task events in a single pass over the profile. Both are
+  // parsed from the same output.
   launchPerfProcess("process events", MMapEventsPPI,
-                    "script --show-mmap-events --no-itrace",
-                    /*Wait = */ false);
-
-  launchPerfProcess("task events", TaskEventsPPI,
-                    "script --show-task-events --no-itrace",
+                    "script --show-mmap-events --show-task-events --no-itrace",
                     /*Wait = */ false);
 }
 
@@ -209,7 +207,6 @@ void DataAggregator::abort() {
   std::string Error;
 
   // Kill subprocesses in case they are not finished
-  sys::Wait(TaskEventsPPI.PI, 1, &Error);
   sys::Wait(MMapEventsPPI.PI, 1, &Error);
   sys::Wait(MainEventsPPI.PI, 1, &Error);
   sys::Wait(MemEventsPPI.PI, 1, &Error);
@@ -524,6 +521,8 @@ Error DataAggregator::preprocessProfile(BinaryContext &BC) {
       ErrorCallback(ReturnCode, ErrBuf);
   };
 
+  prepareToParse("process events", MMapEventsPPI, ErrorCallback);
+
   if (opts::LinuxKernelMode) {
     // Current MMap parsing logic does not work with linux kernel.
     // MMap entries for linux kernel uses PERF_RECORD_MMAP
@@ -540,12 +539,14 @@ Error DataAggregator::preprocessProfile(BinaryContext &BC) {
     // in Linux kernel mode.
     opts::IgnoreInterruptLBR = false;
   } else {
-    prepareToParse("mmap events", MMapEventsPPI, ErrorCallback);
     if (parseMMapEvents())
       errs() << "PERF2BOLT: failed to parse mmap events\n";
+    // Rewind to parse task events from the same output.
+    ParsingBuf = FileBuf->getBuffer();
+    Col = 0;
+    Line = 1;
   }
 
-  prepareToParse("task events", TaskEventsPPI, ErrorCallback);
   if (parseTaskEvents())
     errs() << "PERF2BOLT: failed to parse task events\n";
 
@@ -42,6 +42,7 @@ using namespace llvm;
 namespace opts {
 
 extern cl::OptionCategory BoltOptCategory;
+extern cl::opt<unsigned> Verbosity;
 
 cl::opt<bool>
     InferStaleProfile("infer-stale-profile",
@@ -384,6 +385,9 @@ void matchWeightsByHashes(BinaryContext &BC,
 
   // Index in yaml profile => corresponding (matched) block
   DenseMap<uint64_t, const FlowBlock *> MatchedBlocks;
+  // Samples of the profiled blocks, and of those that were matched.
+  uint64_t FuncSampleCount = 0;
+  uint64_t FuncMatchedSampleCount = 0;
   // Match blocks from the profile to the blocks in CFG
   for (const yaml::bolt::BinaryBasicBlockProfile &YamlBB : YamlBF.Blocks) {
     assert(YamlBB.Hash != 0 && "empty hash of BinaryBasicBlockProfile");
@@ -394,6 +398,7 @@ void matchWeightsByHashes(BinaryContext &BC,
       MatchedBlock = Blocks[0];
     if (MatchedBlock != nullptr) {
       MatchedBlocks[YamlBB.Index] = MatchedBlock;
+      FuncMatchedSampleCount += YamlBB.ExecCount;
       BlendedBlockHash BinHash = BlendedHashes[MatchedBlock->Index - 1];
       LLVM_DEBUG(dbgs() << "Matched yaml block (bid = " << YamlBB.Index << ")"
                         << " with hash " << Twine::utohexstr(YamlBB.Hash)
@@ -415,8 +420,16 @@ void matchWeightsByHashes(BinaryContext &BC,
     // Update matching stats.
     ++BC.Stats.NumStaleBlocks;
     BC.Stats.StaleSampleCount += YamlBB.ExecCount;
+    FuncSampleCount += YamlBB.ExecCount;
   }
 
+  if (opts::Verbosity >= 1)
+    outs() << "BOLT-INFO: stale profile matching for " << YamlBF.Name
+           << ": matched " << MatchedBlocks.size() << " out of "
+           << YamlBF.Blocks.size() << " blocks and " << FuncMatchedSampleCount
+           << " out of " << FuncSampleCount << " samples; dropped "
+           << FuncSampleCount - FuncMatchedSampleCount << " samples\n";
+
   // Match jumps from the profile to the jumps from CFG
   std::vector<uint64_t> OutWeight(Func.Blocks.size(), 0);
   std::vector<uint64_t> InWeight(Func.Blocks.size(), 0);
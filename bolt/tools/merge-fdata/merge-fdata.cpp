@@ -247,6 +247,24 @@ void mergeFunctionProfile(BinaryFunctionProfile &MergedBF,
       MergedBF.Blocks.emplace_back(std::move(*BB));
 }
 
+void readYAMLProfile(const std::string &Filename, BinaryProfile &BP) {
+  ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
+      MemoryBuffer::getFileOrSTDIN(Filename);
+  if (std::error_code EC = MB.getError())
+    report_error(Filename, EC);
+  yaml::Input YamlInput(MB.get()->getBuffer());
+  YamlInput >> BP;
+  if (YamlInput.error())
+    report_error(Filename, YamlInput.error());
+
+  // Sanity check.
+  if (BP.Header.Version != 1) {
+    errs() << "Unable to merge data from profile using version "
+           << BP.Header.Version << '\n';
+    exit(1);
+  }
+}
+
 bool isYAML(const StringRef Filename) {
   ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
       MemoryBuffer::getFileOrSTDIN(Filename);
@@ -307,8 +325,7 @@ void mergeLegacyProfiles(const SmallVectorImpl<std::string> &Filenames) {
       uint64_t Count;
       if (Line.substr(Pos + 1, Line.size() - Pos).getAsInteger(10, Count))
         report_error(Filename, "Malformed / corrupted profile counter");
-      Count += Profile->lookup(Signature);
-      Profile->insert_or_assign(Signature, Count);
+      (*Profile)[Signature] += Count;
     }
   };
 
@@ -324,10 +341,8 @@ void mergeLegacyProfiles(const SmallVectorImpl<std::string> &Filenames) {
 
   ProfileTy MergedProfile;
   for (const auto &[Thread, Profile] : ParsedProfiles)
-    for (const auto &[Key, Value] : Profile) {
-      uint64_t Count = MergedProfile.lookup(Key) + Value;
-      MergedProfile.insert_or_assign(Key, Count);
-    }
+    for (const auto &[Key, Value] : Profile)
+      MergedProfile[Key] += Value;
 
   if (BoltedCollection)
     output() << "boltedcollection\n";
@@ -385,39 +400,36 @@ int main(int argc, char **argv) {
   // Merged information for all functions.
   StringMap<BinaryFunctionProfile> MergedBFs;
 
-  for (std::string &InputDataFilename : Inputs) {
-    ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
-        MemoryBuffer::getFileOrSTDIN(InputDataFilename);
-    if (std::error_code EC = MB.getError())
-      report_error(InputDataFilename, EC);
-    yaml::Input YamlInput(MB.get()->getBuffer());
-
-    errs() << "Merging data from " << InputDataFilename << "...\n";
-
-    BinaryProfile BP;
-    YamlInput >> BP;
-    if (YamlInput.error())
-      report_error(InputDataFilename, YamlInput.error());
-
-    // Sanity check.
-    if (BP.Header.Version != 1) {
-      errs() << "Unable to merge data from profile using version "
-             << BP.Header.Version << '\n';
-      exit(1);
-    }
-
-    // Merge the header.
-    mergeProfileHeaders(MergedHeader, BP.Header);
-
-    // Do the function merge.
-    for (BinaryFunctionProfile &BF : BP.Functions) {
-      if (!MergedBFs.count(BF.Name)) {
-        MergedBFs.insert(std::make_pair(BF.Name, BF));
-        continue;
+  // Parsing YAML dominates the merge time. Parse a window of inputs in
+  // parallel, then merge them in input order so that the result does not
+  // depend on the number of threads. The window bounds the memory used by
+  // profiles that are parsed but not merged yet.
+  ThreadPool Pool(optimal_concurrency(Inputs.size()));
+  const size_t WindowSize = 4 * Pool.getThreadCount();
+  std::vector<BinaryProfile> Profiles;
+  for (size_t Begin = 0; Begin < Inputs.size(); Begin += WindowSize) {
+    const size_t End = std::min(Begin + WindowSize, Inputs.size());
+    Profiles.clear();
+    Profiles.resize(End - Begin);
+    for (size_t I = Begin; I != End; ++I)
+      Pool.async([&, I] { readYAMLProfile(Inputs[I], Profiles[I - Begin]); });
+    Pool.wait();
+
+    for (size_t I = Begin; I != End; ++I) {
+      errs() << "Merging data from " << Inputs[I] << "...\n";
+      BinaryProfile &BP = Profiles[I - Begin];
+
+      // Merge the header.
+      mergeProfileHeaders(MergedHeader, BP.Header);
+
+      // Do the function merge.
+      for (BinaryFunctionProfile &BF : BP.Functions) {
+        auto [It, Inserted] = MergedBFs.try_emplace(BF.Name);
+        if (Inserted)
+          It->second = std::move(BF);
+        else
+          mergeFunctionProfile(It->second, std::move(BF));
       }
-
-      BinaryFunctionProfile &MergedBF = MergedBFs.find(BF.Name)->second;
-      mergeFunctionProfile(MergedBF, std::move(BF));
     }
   }
 
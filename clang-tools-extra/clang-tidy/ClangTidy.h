@@ -78,6 +78,12 @@ getCheckOptions(const ClangTidyOptions &Options,
 
 /// Run a set of clang-tidy checks on a set of files.
 ///
+/// The files are processed one after another by a single ClangTool, so they
+/// share its FileManager and stat cache, and diagnostics reported in a header
+/// included by several of them are deduplicated before being returned.
+/// \p Context is not thread-safe; parallelism across translation units is
+/// left to drivers such as run-clang-tidy.py that run one process per file.
+///
 /// \param EnableCheckProfile If provided, it enables check profile collection
 /// in MatchFinder, and will contain the result of the profile.
 /// \param StoreCheckProfile If provided, and EnableCheckProfile is true,
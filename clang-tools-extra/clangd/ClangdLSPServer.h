@@ -19,6 +19,7 @@
 #include "support/MemoryTree.h"
 #include "support/Path.h"
 #include "support/Threading.h"
+#include "support/Trace.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/Support/JSON.h"
 #include <chrono>
@@ -63,6 +64,9 @@ public:
 
     /// Limit the number of references returned (0 means no limit).
     size_t ReferencesLimit = 0;
+
+    /// If set, latency histograms are served via $/clangd/metrics.
+    const trace::HistogramTracer *Metrics = nullptr;
   };
 
   ClangdLSPServer(Transport &Transp, const ThreadsafeFS &TFS,
@@ -169,6 +173,9 @@ private:
   /// This is a clangd extension. Provides a json tree representing memory usage
   /// hierarchy.
   void onMemoryUsage(const NoParams &, Callback<MemoryTree>);
+  /// This is a clangd extension. Provides percentiles of the distributions
+  /// recorded by Opts.Metrics, keyed by metric and label.
+  void onMetrics(const NoParams &, Callback<llvm::json::Value>);
   void onCommand(const ExecuteCommandParams &, Callback<llvm::json::Value>);
 
   /// Implement commands.
@@ -1871,13 +1871,19 @@ private:
       C.IdentifierResult = IdentifierResult;
       if (C.IndexResult) {
         C.Name = IndexResult->Name;
-        C.RankedIncludeHeaders = getRankedIncludes(*C.IndexResult);
       } else if (C.SemaResult) {
         C.Name = Recorder->getName(*SemaResult);
       } else {
         assert(IdentifierResult);
         C.Name = IdentifierResult->Name;
       }
+      // Bundles share a name, so a candidate that fails the filter would be
+      // dropped by addCandidate() anyway. Skip it before doing the expensive
+      // work of ranking headers and computing its overload set.
+      if (!fuzzyScore(C))
+        return;
+      if (C.IndexResult)
+        C.RankedIncludeHeaders = getRankedIncludes(*C.IndexResult);
       if (auto OverloadSet = C.overloadSet(
               Opts, FileName, Inserter ? &*Inserter : nullptr, CCContextKind)) {
         auto Ret = BundleLookup.try_emplace(OverloadSet, Bundles.size());
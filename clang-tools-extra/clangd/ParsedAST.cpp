@@ -402,6 +402,13 @@ ParsedAST::build(llvm::StringRef Filename, const ParseInputs &Inputs,
                  std::unique_ptr<clang::CompilerInvocation> CI,
                  llvm::ArrayRef<Diag> CompilerInvocationDiags,
                  std::shared_ptr<const PreambleData> Preamble) {
+  // The main file is always parsed from scratch on top of the preamble. Clang
+  // has no way to re-parse a single function body into an existing
+  // ASTContext: Sema's state (scopes, pending instantiations, lambda and
+  // template numbering, diagnostics already emitted) depends on everything
+  // parsed before it, and AST nodes cannot be removed once created. Large
+  // main files are instead kept fast by keeping as much as possible in the
+  // preamble and by skipping function bodies there.
   trace::Span Tracer("BuildAST");
   SPAN_ATTACH(Tracer, "File", Filename);
   const Config &Cfg = Config::current();
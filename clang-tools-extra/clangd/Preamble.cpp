@@ -592,6 +592,12 @@ buildPreamble(PathRef FileName, CompilerInvocation CI,
               const ParseInputs &Inputs, bool StoreInMemory,
               PreambleParsedCallback PreambleCallback,
               PreambleBuildStats *Stats) {
+  // Preambles are built per file and are never shared between files, even
+  // when two files start with an identical include prefix and compile flags.
+  // The PCH records the main file it was built from (ASTReader registers it as
+  // the preamble FileID), so include locations, macros defined in the preamble
+  // region and diagnostics would all point into the wrong buffer if the
+  // preamble were attached to another file.
   // Note that we don't need to copy the input contents, preamble can live
   // without those.
   auto ContentsBuffer =
@@ -8,6 +8,8 @@
 
 #include "../index/Serialization.h"
 #include "../index/dex/Dex.h"
+#include "../index/dex/Iterator.h"
+#include "../index/dex/PostingList.h"
 #include "benchmark/benchmark.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
@@ -97,6 +99,35 @@ static void dexBuild(benchmark::State &State) {
 }
 BENCHMARK(dexBuild);
 
+// Every N-th document of a corpus of the given size.
+std::vector<dex::DocID> everyNth(dex::DocID N, dex::DocID Size) {
+  std::vector<dex::DocID> Docs;
+  for (dex::DocID Doc = 0; Doc < Size; Doc += N)
+    Docs.push_back(Doc);
+  return Docs;
+}
+
+static void postingListIterate(benchmark::State &State) {
+  const dex::PostingList List(everyNth(3, 1 << 20));
+  for (auto _ : State)
+    benchmark::DoNotOptimize(dex::consume(*List.iterator()));
+}
+BENCHMARK(postingListIterate);
+
+static void postingListIntersect(benchmark::State &State) {
+  const dex::PostingList Dense(everyNth(3, 1 << 20));
+  const dex::PostingList Sparse(everyNth(997, 1 << 20));
+  const dex::Corpus Corpus(1 << 20);
+  for (auto _ : State) {
+    std::vector<std::unique_ptr<dex::Iterator>> Children;
+    Children.push_back(Dense.iterator());
+    Children.push_back(Sparse.iterator());
+    benchmark::DoNotOptimize(
+        dex::consume(*Corpus.intersect(std::move(Children))));
+  }
+}
+BENCHMARK(postingListIntersect);
+
 } // namespace
 } // namespace clangd
 } // namespace clang
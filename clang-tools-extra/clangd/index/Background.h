@@ -24,6 +24,7 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Support/Threading.h"
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
@@ -100,6 +101,10 @@ public:
   // lower priority.
   // Reducing the boost of a tag affects future tasks but not current ones.
   void boost(llvm::StringRef Tag, unsigned NewPriority);
+  // Hold off starting new tasks for the given duration, so that interactive
+  // work is not competing with the indexer. Tasks already running are not
+  // interrupted. Each call replaces the previous hold; a zero duration ends it.
+  void preempt(std::chrono::steady_clock::duration For);
 
   // Process items on the queue until the queue is stopped.
   // If the queue becomes empty, OnIdle will be called (on one worker).
@@ -122,6 +127,7 @@ private:
   Stats Stat;
   std::condition_variable CV;
   bool ShouldStop = false;
+  Deadline HeldUntil = Deadline::zero(); // No new tasks start before this.
   std::vector<Task> Queue; // max-heap
   llvm::StringMap<unsigned> Boosts;
   std::function<void(Stats)> OnProgress;
@@ -145,6 +151,9 @@ public:
     // file. Called with the empty string for other tasks.
     // (When called, the context from BackgroundIndex construction is active).
     std::function<Context(PathRef)> ContextProvider = nullptr;
+    // How long indexing stays paused after preemptForForegroundWork().
+    std::chrono::steady_clock::duration ForegroundPreemptWindow =
+        std::chrono::milliseconds(500);
   };
 
   /// Creates a new background index and starts its threads.
@@ -165,6 +174,10 @@ public:
   /// Typically used to index TUs when headers are opened.
   void boostRelated(llvm::StringRef Path);
 
+  /// Briefly pauses background indexing after an interactive request (e.g. an
+  /// edit), so the resulting rebuild gets the CPU first.
+  void preemptForForegroundWork() { Queue.preempt(ForegroundPreemptWindow); }
+
   // Cause background threads to stop after ther current task, any remaining
   // tasks will be discarded.
   void stop() {
@@ -199,6 +212,7 @@ private:
   const GlobalCompilationDatabase &CDB;
   llvm::ThreadPriority IndexingPriority;
   std::function<Context(PathRef)> ContextProvider;
+  std::chrono::steady_clock::duration ForegroundPreemptWindow;
 
   llvm::Error index(tooling::CompileCommand);
 
@@ -24,7 +24,12 @@ void BackgroundQueue::work(std::function<void()> OnIdle) {
     std::optional<Task> Task;
     {
       std::unique_lock<std::mutex> Lock(Mu);
-      CV.wait(Lock, [&] { return ShouldStop || !Queue.empty(); });
+      while (!ShouldStop && (Queue.empty() || !HeldUntil.expired())) {
+        if (Queue.empty())
+          CV.wait(Lock);
+        else
+          clangd::wait(Lock, CV, HeldUntil);
+      }
       if (ShouldStop) {
         Queue.clear();
         CV.notify_all();
@@ -133,6 +138,17 @@ void BackgroundQueue::boost(llvm::StringRef Tag, unsigned NewPriority) {
   // No need to signal, only rearranged items in the queue.
 }
 
+void BackgroundQueue::preempt(std::chrono::steady_clock::duration For) {
+  {
+    std::lock_guard<std::mutex> Lock(Mu);
+    HeldUntil = For.count() > 0
+                    ? Deadline(std::chrono::steady_clock::now() + For)
+                    : Deadline::zero();
+  }
+  // Workers may be sleeping until an earlier deadline.
+  CV.notify_all();
+}
+
 bool BackgroundQueue::blockUntilIdleForTest(
     std::optional<double> TimeoutSeconds) {
   std::unique_lock<std::mutex> Lock(Mu);
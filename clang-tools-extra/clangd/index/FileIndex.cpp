@@ -277,6 +277,12 @@ FileSymbols::buildIndex(IndexType Type, DuplicateHandling DuplicateHandle,
   std::vector<RefSlab *> MainFileRefs;
   {
     std::lock_guard<std::mutex> Lock(Mutex);
+    // The sizes are only known under the lock, but reserving them up front
+    // keeps the copy below from reallocating repeatedly while it is held.
+    SymbolSlabs.reserve(SymbolsSnapshot.size());
+    RefSlabs.reserve(RefsSnapshot.size());
+    RelationSlabs.reserve(RelationsSnapshot.size());
+    Files.reserve(SymbolsSnapshot.size());
     for (const auto &FileAndSymbols : SymbolsSnapshot) {
       SymbolSlabs.push_back(FileAndSymbols.second);
       Files.insert(FileAndSymbols.first());
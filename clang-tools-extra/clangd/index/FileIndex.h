@@ -67,6 +67,10 @@ enum class DuplicateHandling {
 ///
 /// The snapshot semantics keeps critical sections minimal since we only need
 /// locking when we swap or obtain references to snapshots.
+///
+/// Queries never touch this class: they run against the index returned by
+/// buildIndex(), published through a SwapIndex, so they are not blocked by
+/// update() or by a rebuild in progress.
 class FileSymbols {
 public:
   FileSymbols(IndexContents IdxContents);
@@ -10,7 +10,6 @@
 #include "index/dex/Iterator.h"
 #include "index/dex/Token.h"
 #include "llvm/Support/MathExtras.h"
-#include <optional>
 
 namespace clang {
 namespace clangd {
@@ -101,9 +100,18 @@ private:
   void advanceToChunk(DocID ID) {
     if ((CurrentChunk != Chunks.end() - 1) &&
         ((CurrentChunk + 1)->Head <= ID)) {
-      CurrentChunk =
-          std::partition_point(CurrentChunk + 1, Chunks.end(),
-                               [&](const Chunk &C) { return C.Head < ID; });
+      // Consecutive targets of an AND iterator tend to be close to each other,
+      // so gallop ahead before the binary search: this takes O(log(distance))
+      // rather than O(log(remaining chunks)) steps.
+      auto Begin = CurrentChunk + 1;
+      size_t Step = 1;
+      while (Step < size_t(Chunks.end() - Begin) && (Begin + Step)->Head < ID) {
+        Begin += Step;
+        Step *= 2;
+      }
+      auto End = Begin + std::min(Step, size_t(Chunks.end() - Begin));
+      CurrentChunk = std::partition_point(
+          Begin, End, [&](const Chunk &C) { return C.Head < ID; });
       --CurrentChunk;
       DecompressedChunk = CurrentChunk->decompress();
       CurrentID = DecompressedChunk.begin();
@@ -181,38 +189,33 @@ std::vector<Chunk> encodeStream(llvm::ArrayRef<DocID> Documents) {
   return std::vector<Chunk>(Result); // no move, shrink-to-fit
 }
 
-/// Reads variable length DocID from the buffer and updates the buffer size. If
-/// the stream is terminated, return std::nullopt.
-std::optional<DocID> readVByte(llvm::ArrayRef<uint8_t> &Bytes) {
-  if (Bytes.front() == 0 || Bytes.empty())
-    return std::nullopt;
-  DocID Result = 0;
-  bool HasNextByte = true;
-  for (size_t Length = 0; HasNextByte && !Bytes.empty(); ++Length) {
-    assert(Length <= 5 && "Malformed VByte encoding sequence.");
-    // Write meaningful bits to the correct place in the document decoding.
-    Result |= (Bytes.front() & 0x7f) << (BitsPerEncodingByte * Length);
-    if ((Bytes.front() & 0x80) == 0)
-      HasNextByte = false;
-    Bytes = Bytes.drop_front();
-  }
-  return Result;
-}
-
 } // namespace
 
+/// Decodes the VByte stream written by encodeStream() in a single pass over the
+/// payload. Deltas are never zero, so neither is any byte of their encoding:
+/// the first zero byte marks the end of the stream.
 llvm::SmallVector<DocID, Chunk::PayloadSize + 1> Chunk::decompress() const {
   llvm::SmallVector<DocID, Chunk::PayloadSize + 1> Result{Head};
-  llvm::ArrayRef<uint8_t> Bytes(Payload);
-  DocID Delta;
-  for (DocID Current = Head; !Bytes.empty(); Current += Delta) {
-    auto MaybeDelta = readVByte(Bytes);
-    if (!MaybeDelta)
+  DocID Current = Head;
+  DocID Delta = 0;
+  unsigned Shift = 0;
+  for (uint8_t Byte : Payload) {
+    if (Byte == 0)
       break;
-    Delta = *MaybeDelta;
-    Result.push_back(Current + Delta);
+    assert(Shift <= BitsPerEncodingByte * 4 &&
+           "Malformed VByte encoding sequence.");
+    // Write meaningful bits to the correct place in the document decoding.
+    Delta |= DocID(Byte & 0x7f) << Shift;
+    if (Byte & 0x80) {
+      Shift += BitsPerEncodingByte;
+      continue;
+    }
+    Current += Delta;
+    Result.push_back(Current);
+    Delta = 0;
+    Shift = 0;
   }
-  return llvm::SmallVector<DocID, Chunk::PayloadSize + 1>{Result};
+  return Result;
 }
 
 PostingList::PostingList(llvm::ArrayRef<DocID> Documents)
@@ -10,6 +10,7 @@
 
 #include "Client.h"
 #include "Feature.h"
+#include "LookupCache.h"
 #include "Service.grpc.pb.h"
 #include "index/Index.h"
 #include "marshalling/Marshalling.h"
@@ -116,7 +117,7 @@ class IndexClient : public clangd::SymbolIndex {
 public:
   IndexClient(
       std::shared_ptr<grpc::Channel> Channel, llvm::StringRef Address,
-      llvm::StringRef ProjectRoot,
+      llvm::StringRef ProjectRoot, bool CacheLookups,
       std::chrono::milliseconds DeadlineTime = std::chrono::milliseconds(1000))
       : Stub(remote::v1::SymbolIndex::NewStub(Channel)), Channel(Channel),
         ServerAddress(Address),
@@ -125,12 +126,26 @@ public:
                                           /*LocalIndexRoot=*/ProjectRoot)),
         DeadlineWaitingTime(DeadlineTime) {
     assert(!ProjectRoot.empty());
+    if (CacheLookups)
+      Cache = std::make_unique<LookupCache>(/*MaxSymbols=*/10000,
+                                            std::chrono::minutes(5));
   }
 
   void lookup(const clangd::LookupRequest &Request,
               llvm::function_ref<void(const clangd::Symbol &)> Callback)
       const override {
-    streamRPC(Request, &remote::v1::SymbolIndex::Stub::Lookup, Callback);
+    if (!Cache) {
+      streamRPC(Request, &remote::v1::SymbolIndex::Stub::Lookup, Callback);
+      return;
+    }
+    clangd::LookupRequest Missing = Cache->lookup(Request, Callback);
+    if (Missing.IDs.empty())
+      return;
+    streamRPC(Missing, &remote::v1::SymbolIndex::Stub::Lookup,
+              [&](const clangd::Symbol &S) {
+                Cache->insert(S);
+                Callback(S);
+              });
   }
 
   bool fuzzyFind(const clangd::FuzzyFindRequest &Request,
@@ -178,16 +193,19 @@ private:
   std::unique_ptr<Marshaller> ProtobufMarshaller;
   // Each request will be terminated if it takes too long.
   std::chrono::milliseconds DeadlineWaitingTime;
+  // Remembers lookup results if the client was created with CacheLookups.
+  std::unique_ptr<LookupCache> Cache;
 };
 
 } // namespace
 
 std::unique_ptr<clangd::SymbolIndex> getClient(llvm::StringRef Address,
-                                               llvm::StringRef ProjectRoot) {
+                                               llvm::StringRef ProjectRoot,
+                                               bool CacheLookups) {
   const auto Channel =
       grpc::CreateChannel(Address.str(), grpc::InsecureChannelCredentials());
   return std::unique_ptr<clangd::SymbolIndex>(
-      new IndexClient(Channel, Address, ProjectRoot));
+      new IndexClient(Channel, Address, ProjectRoot, CacheLookups));
 }
 
 } // namespace remote
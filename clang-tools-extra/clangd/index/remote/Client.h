@@ -22,12 +22,17 @@ namespace remote {
 /// described by the remote index. Paths returned by the index will be treated
 /// as relative to this directory.
 ///
+/// If \p CacheLookups is set, symbols returned by lookups are remembered on
+/// the client for a few minutes; they may be stale for that long after the
+/// server loads a new index.
+///
 /// This method attempts to resolve the address and establish the connection.
 ///
 /// \returns nullptr if the address is not resolved during the function call or
 /// if the project was compiled without Remote Index support.
 std::unique_ptr<clangd::SymbolIndex> getClient(llvm::StringRef Address,
-                                               llvm::StringRef IndexRoot);
+                                               llvm::StringRef IndexRoot,
+                                               bool CacheLookups = false);
 
 } // namespace remote
 } // namespace clangd
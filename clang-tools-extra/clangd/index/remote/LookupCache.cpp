@@ -0,0 +1,53 @@
+//===--- LookupCache.cpp -----------------------------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "LookupCache.h"
+#include <vector>
+
+namespace clang {
+namespace clangd {
+namespace remote {
+
+LookupRequest
+LookupCache::lookup(const LookupRequest &Request,
+                    llvm::function_ref<void(const Symbol &)> Callback) {
+  LookupRequest Missing;
+  std::vector<Symbol> Hits;
+  std::shared_ptr<SymbolSlab::Builder> Owner;
+  {
+    std::lock_guard<std::mutex> Lock(Mu);
+    auto Now = std::chrono::steady_clock::now();
+    if (NumSymbols > MaxSymbols || Now - Created >= Lifetime) {
+      Symbols = std::make_shared<SymbolSlab::Builder>();
+      NumSymbols = 0;
+      Created = Now;
+    }
+    for (const SymbolID &ID : Request.IDs) {
+      if (const Symbol *S = Symbols->find(ID))
+        Hits.push_back(*S);
+      else
+        Missing.IDs.insert(ID);
+    }
+    // The copies in Hits point into the builder's arena.
+    if (!Hits.empty())
+      Owner = Symbols;
+  }
+  for (const Symbol &S : Hits)
+    Callback(S);
+  return Missing;
+}
+
+void LookupCache::insert(const Symbol &S) {
+  std::lock_guard<std::mutex> Lock(Mu);
+  Symbols->insert(S);
+  ++NumSymbols;
+}
+
+} // namespace remote
+} // namespace clangd
+} // namespace clang
@@ -0,0 +1,64 @@
+//===--- LookupCache.h - Client-side cache of remote lookups -----*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_TOOLS_EXTRA_CLANGD_INDEX_REMOTE_LOOKUPCACHE_H
+#define LLVM_CLANG_TOOLS_EXTRA_CLANGD_INDEX_REMOTE_LOOKUPCACHE_H
+
+#include "index/Index.h"
+#include "index/Symbol.h"
+#include "llvm/ADT/FunctionExtras.h"
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace clang {
+namespace clangd {
+namespace remote {
+
+/// Remembers the symbols returned by remote lookups, so that repeated lookups
+/// of the same IDs (e.g. from completion and hover) don't need a round trip.
+///
+/// The remote index protocol has no notion of an index version, so cached
+/// symbols may be stale for up to the cache lifetime after the server loads a
+/// new index. The whole cache is dropped once it is older than its lifetime or
+/// holds more than its maximum number of symbols.
+///
+/// This class is thread-safe. Callbacks are never invoked with the internal
+/// lock held, so they may re-enter the index.
+class LookupCache {
+public:
+  LookupCache(size_t MaxSymbols, std::chrono::steady_clock::duration Lifetime)
+      : MaxSymbols(MaxSymbols), Lifetime(Lifetime),
+        Symbols(std::make_shared<SymbolSlab::Builder>()),
+        Created(std::chrono::steady_clock::now()) {}
+
+  /// Calls \p Callback for each symbol of \p Request that is cached, and
+  /// returns a request for the IDs that are not.
+  LookupRequest lookup(const LookupRequest &Request,
+                       llvm::function_ref<void(const Symbol &)> Callback);
+
+  /// Adds a symbol returned by the server.
+  void insert(const Symbol &S);
+
+private:
+  const size_t MaxSymbols;
+  const std::chrono::steady_clock::duration Lifetime;
+
+  std::mutex Mu;
+  /// Shared with in-flight lookups, which keep the strings of the symbols they
+  /// report alive after the cache is dropped.
+  std::shared_ptr<SymbolSlab::Builder> Symbols;
+  size_t NumSymbols = 0;
+  std::chrono::steady_clock::time_point Created;
+};
+
+} // namespace remote
+} // namespace clangd
+} // namespace clang
+
+#endif // LLVM_CLANG_TOOLS_EXTRA_CLANGD_INDEX_REMOTE_LOOKUPCACHE_H
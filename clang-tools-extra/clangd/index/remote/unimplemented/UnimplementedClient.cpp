@@ -15,7 +15,8 @@ namespace clangd {
 namespace remote {
 
 std::unique_ptr<clangd::SymbolIndex> getClient(llvm::StringRef Address,
-                                               llvm::StringRef IndexRoot) {
+                                               llvm::StringRef IndexRoot,
+                                               bool CacheLookups) {
   elog("Can't create SymbolIndex client without Remote Index support.");
   return nullptr;
 }
@@ -23,7 +23,9 @@
 #include "clang/Tooling/Execution.h"
 #include "clang/Tooling/Tooling.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Signals.h"
+#include "llvm/Support/xxhash.h"
 #include <utility>
 
 namespace clang {
@@ -48,6 +50,34 @@ static llvm::cl::list<std::string> QueryDriverGlobs{
     llvm::cl::CommaSeparated,
 };
 
+static llvm::cl::opt<unsigned> ShardCount{
+    "shard-count",
+    llvm::cl::desc("Split the translation units into this many shards and "
+                   "only index the one selected by -shard-index. "
+                   "Use -merge to combine the resulting index files."),
+    llvm::cl::init(1),
+};
+
+static llvm::cl::opt<unsigned> ShardIndex{
+    "shard-index",
+    llvm::cl::desc("Index of the shard to index, in [0, shard-count)"),
+    llvm::cl::init(0),
+};
+
+static llvm::cl::list<std::string> MergeInputs{
+    "merge",
+    llvm::cl::desc("Instead of indexing, merge these comma-separated index "
+                   "files (e.g. produced with -shard-count) into one"),
+    llvm::cl::CommaSeparated,
+};
+
+// Whether the translation unit for MainFile belongs to the selected shard.
+// Hashing the path keeps the split stable across machines.
+static bool inSelectedShard(llvm::StringRef MainFile) {
+  return ShardCount <= 1 ||
+         llvm::xxh3_64bits(MainFile) % ShardCount == ShardIndex;
+}
+
 class IndexActionFactory : public tooling::FrontendActionFactory {
 public:
   IndexActionFactory(IndexFileIn &Result) : Result(Result) {}
@@ -98,6 +128,10 @@ public:
                      FileManager *Files,
                      std::shared_ptr<PCHContainerOperations> PCHContainerOps,
                      DiagnosticConsumer *DiagConsumer) override {
+    const auto &Inputs = Invocation->getFrontendOpts().Inputs;
+    if (!Inputs.empty() && Inputs.front().isFile() &&
+        !inSelectedShard(Inputs.front().getFile()))
+      return true;
     disableUnsupportedOptions(*Invocation);
     return tooling::FrontendActionFactory::runInvocation(
         std::move(Invocation), Files, std::move(PCHContainerOps), DiagConsumer);
@@ -123,6 +157,45 @@ private:
   RelationSlab::Builder Relations;
 };
 
+// Merges index files produced by separate runs (typically separate shards).
+// Symbols seen in several inputs are combined with mergeSymbol(), refs and
+// relations are deduplicated by their builders.
+static bool mergeIndexFiles(IndexFileIn &Result) {
+  SymbolSlab::Builder Symbols;
+  RefSlab::Builder Refs;
+  RelationSlab::Builder Relations;
+  for (const std::string &Path : MergeInputs) {
+    auto Buffer = llvm::MemoryBuffer::getFile(Path);
+    if (!Buffer) {
+      elog("Can't open {0}: {1}", Path, Buffer.getError().message());
+      return false;
+    }
+    auto In = readIndexFile((*Buffer)->getBuffer(), SymbolOrigin::Static);
+    if (!In) {
+      elog("Bad index file {0}: {1}", Path, In.takeError());
+      return false;
+    }
+    if (In->Symbols)
+      for (const auto &Sym : *In->Symbols) {
+        if (const auto *Existing = Symbols.find(Sym.ID))
+          Symbols.insert(mergeSymbol(*Existing, Sym));
+        else
+          Symbols.insert(Sym);
+      }
+    if (In->Refs)
+      for (const auto &Sym : *In->Refs)
+        for (const auto &Ref : Sym.second)
+          Refs.insert(Sym.first, Ref);
+    if (In->Relations)
+      for (const auto &R : *In->Relations)
+        Relations.insert(R);
+  }
+  Result.Symbols = std::move(Symbols).build();
+  Result.Refs = std::move(Refs).build();
+  Result.Relations = std::move(Relations).build();
+  return true;
+}
+
 } // namespace
 } // namespace clangd
 } // namespace clang
@@ -141,9 +214,36 @@ int main(int argc, const char **argv) {
 
   $ clangd-indexer File1.cpp File2.cpp ... FileN.cpp > clangd.dex
 
+  Example usage for indexing a large project on several machines:
+
+  $ clangd-indexer --executor=all-TUs --shard-count=2 --shard-index=0 \
+      compile_commands.json > shard0.dex
+  $ clangd-indexer --executor=all-TUs --shard-count=2 --shard-index=1 \
+      compile_commands.json > shard1.dex
+  $ clangd-indexer --merge=shard0.dex,shard1.dex > clangd.dex
+
   Note: only symbols from header files will be indexed.
   )";
 
+  // Merging needs no compilation database or sources, so don't set up an
+  // executor (which insists on having some). Look for every spelling cl::opt
+  // accepts: -merge=a.dex, -merge a.dex, and the same with two dashes.
+  if (llvm::any_of(llvm::ArrayRef(argv, argc), [](llvm::StringRef Arg) {
+        if (!Arg.consume_front("-"))
+          return false;
+        Arg.consume_front("-");
+        return Arg == "merge" || Arg.starts_with("merge=");
+      })) {
+    llvm::cl::ParseCommandLineOptions(argc, argv, Overview);
+    clang::clangd::IndexFileIn Data;
+    if (!clang::clangd::mergeIndexFiles(Data))
+      return 1;
+    clang::clangd::IndexFileOut Out(Data);
+    Out.Format = clang::clangd::Format;
+    llvm::outs() << Out;
+    return 0;
+  }
+
   auto Executor = clang::tooling::createExecutorFromCommandLineArgs(
       argc, argv, llvm::cl::getGeneralCategory(), Overview);
 
@@ -152,6 +252,11 @@ int main(int argc, const char **argv) {
     return 1;
   }
 
+  if (clang::clangd::ShardIndex >= clang::clangd::ShardCount) {
+    llvm::errs() << "-shard-index must be less than -shard-count\n";
+    return 1;
+  }
+
   // Collect symbols found in each translation unit, merging as we go.
   clang::clangd::IndexFileIn Data;
   auto Mangler = std::make_shared<clang::clangd::CommandMangler>(
@@ -16,6 +16,8 @@
 #include "llvm/Support/Threading.h"
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -274,6 +276,89 @@ std::unique_ptr<EventTracer> createCSVMetricTracer(llvm::raw_ostream &OS) {
   return std::make_unique<CSVMetricTracer>(OS);
 }
 
+// Bucket 0 holds non-positive samples. Positive samples are keyed by their
+// binary exponent and the top three bits of their mantissa, so that keys grow
+// with the value.
+static constexpr int SubBuckets = 8;
+
+static int bucketFor(double Value) {
+  if (!(Value > 0))
+    return std::numeric_limits<int>::min();
+  int Exp;
+  double Mantissa = std::frexp(Value, &Exp); // in [0.5, 1)
+  int Sub = std::min(SubBuckets - 1, int((Mantissa - 0.5) * 2 * SubBuckets));
+  return Exp * SubBuckets + Sub;
+}
+
+// Returns the largest value that falls in the bucket.
+static double bucketUpperBound(int Bucket) {
+  if (Bucket == std::numeric_limits<int>::min())
+    return 0;
+  int Exp = Bucket >= 0 ? Bucket / SubBuckets
+                        : -((SubBuckets - 1 - Bucket) / SubBuckets);
+  int Sub = Bucket - Exp * SubBuckets;
+  return std::ldexp(0.5 + double(Sub + 1) / (2 * SubBuckets), Exp);
+}
+
+Context HistogramTracer::beginSpan(
+    llvm::StringRef Name,
+    llvm::function_ref<void(llvm::json::Object *)> AttachDetails) {
+  if (Next)
+    return Next->beginSpan(Name, AttachDetails);
+  return EventTracer::beginSpan(Name, AttachDetails);
+}
+
+void HistogramTracer::endSpan() {
+  if (Next)
+    Next->endSpan();
+}
+
+void HistogramTracer::instant(llvm::StringRef Name,
+                              llvm::json::Object &&Args) {
+  if (Next)
+    Next->instant(Name, std::move(Args));
+}
+
+void HistogramTracer::record(const Metric &Metric, double Value,
+                             llvm::StringRef Label) {
+  if (Metric.Type == Metric::Distribution) {
+    std::lock_guard<std::mutex> Lock(Mu);
+    Histogram &H = Histograms[Metric.Name][Label];
+    H.Max = H.Count ? std::max(H.Max, Value) : Value;
+    ++H.Count;
+    H.Sum += Value;
+    ++H.Buckets[bucketFor(Value)];
+  }
+  if (Next)
+    Next->record(Metric, Value, Label);
+}
+
+llvm::json::Value HistogramTracer::snapshot() const {
+  std::lock_guard<std::mutex> Lock(Mu);
+  llvm::json::Object Result;
+  for (const auto &MetricAndLabels : Histograms) {
+    llvm::json::Object Labels;
+    for (const auto &LabelAndHistogram : MetricAndLabels.second) {
+      const Histogram &H = LabelAndHistogram.second;
+      auto Percentile = [&](double Q) {
+        uint64_t Rank = std::max<uint64_t>(1, std::ceil(Q * H.Count));
+        uint64_t Seen = 0;
+        for (const auto &[Bucket, N] : H.Buckets)
+          if ((Seen += N) >= Rank)
+            return std::min(H.Max, bucketUpperBound(Bucket));
+        return H.Max;
+      };
+      Labels[LabelAndHistogram.first()] = llvm::json::Object{
+          {"count", int64_t(H.Count)}, {"mean", H.Sum / H.Count},
+          {"max", H.Max},              {"p50", Percentile(0.5)},
+          {"p90", Percentile(0.9)},    {"p99", Percentile(0.99)},
+      };
+    }
+    Result[MetricAndLabels.first()] = std::move(Labels);
+  }
+  return Result;
+}
+
 void log(const llvm::Twine &Message) {
   if (!T)
     return;
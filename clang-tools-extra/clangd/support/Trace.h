@@ -18,11 +18,14 @@
 #define LLVM_CLANG_TOOLS_EXTRA_CLANGD_SUPPORT_TRACE_H
 
 #include "support/Context.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/JSON.h"
 #include "llvm/Support/raw_ostream.h"
 #include <chrono>
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -125,6 +128,41 @@ std::unique_ptr<EventTracer> createJSONTracer(llvm::raw_ostream &OS,
 /// Trace spans and instant events are ignored.
 std::unique_ptr<EventTracer> createCSVMetricTracer(llvm::raw_ostream &OS);
 
+/// An EventTracer that aggregates Distribution metrics into histograms in
+/// memory, so that percentiles can be queried while clangd is running.
+/// Spans, events and all measurements are forwarded to \p Next, if provided.
+///
+/// Samples are bucketed log-linearly (8 buckets per power of two), so reported
+/// percentiles are within 12.5% of the true value.
+class HistogramTracer : public EventTracer {
+public:
+  HistogramTracer(EventTracer *Next = nullptr) : Next(Next) {}
+
+  Context beginSpan(
+      llvm::StringRef Name,
+      llvm::function_ref<void(llvm::json::Object *)> AttachDetails) override;
+  void endSpan() override;
+  void instant(llvm::StringRef Name, llvm::json::Object &&Args) override;
+  void record(const Metric &Metric, double Value,
+              llvm::StringRef Label) override;
+
+  /// Returns an object keyed by metric name, then by label, describing each
+  /// distribution seen so far: count, mean, max, p50, p90 and p99.
+  llvm::json::Value snapshot() const;
+
+private:
+  struct Histogram {
+    uint64_t Count = 0;
+    double Sum = 0;
+    double Max = 0;
+    std::map<int, uint64_t> Buckets; // Sparse, ordered by magnitude.
+  };
+
+  EventTracer *Next;
+  mutable std::mutex Mu;
+  llvm::StringMap<llvm::StringMap<Histogram>> Histograms /*GUARDED_BY(Mu)*/;
+};
+
 /// Records a single instant event, associated with the current thread.
 void log(const llvm::Twine &Name);
 
@@ -484,6 +484,15 @@ opt<bool> PrettyPrint{
     init(false),
 };
 
+opt<bool> MetricsHistograms{
+    "metrics-histograms",
+    cat(Protocol),
+    desc("Keep latency histograms in memory and serve them via the "
+         "$/clangd/metrics extension method"),
+    init(false),
+    Hidden,
+};
+
 opt<bool> EnableConfig{
     "enable-config",
     cat(Misc),
@@ -550,6 +559,15 @@ opt<std::string> ProjectRoot{
 };
 #endif
 
+opt<bool> RemoteIndexCacheLookups{
+    "remote-index-cache-lookups",
+    cat(Features),
+    desc("Remember the results of remote index lookups for a few minutes. "
+         "They may be stale for that long after the server loads a new index"),
+    init(false),
+    Hidden,
+};
+
 /// Supports a test URI scheme with relaxed constraints for lit tests.
 /// The path in a test URI will be combined with a platform-specific fake
 /// directory to form an absolute path. For example, test:///a.cpp is resolved
@@ -606,7 +624,8 @@ loadExternalIndex(const Config::ExternalIndexSpec &External,
     RemoteIndexUsed.record(1, External.Location);
     log("Associating {0} with remote index at {1}.", External.MountPoint,
         External.Location);
-    return remote::getClient(External.Location, External.MountPoint);
+    return remote::getClient(External.Location, External.MountPoint,
+                             RemoteIndexCacheLookups);
   case Config::ExternalIndexSpec::File:
     log("Associating {0} with monolithic index at {1}.", External.MountPoint,
         External.Location);
@@ -826,8 +845,14 @@ clangd accepts flags on the commandline, and in the CLANGD_FLAGS environment var
     }
   }
 
+  std::optional<trace::HistogramTracer> Metrics;
+  if (MetricsHistograms)
+    Metrics.emplace(Tracer.get());
+
   std::optional<trace::Session> TracingSession;
-  if (Tracer)
+  if (Metrics)
+    TracingSession.emplace(*Metrics);
+  else if (Tracer)
     TracingSession.emplace(*Tracer);
 
   // If a user ran `clangd` in a terminal without redirecting anything,
@@ -897,6 +922,8 @@ clangd accepts flags on the commandline, and in the CLANGD_FLAGS environment var
   Opts.StaticIndex = PAI.get();
   Opts.AsyncThreadsCount = WorkerThreadsCount;
   Opts.MemoryCleanup = getMemoryCleanupFunction();
+  if (Metrics)
+    Opts.Metrics = &*Metrics;
 
   Opts.CodeComplete.IncludeIneligibleResults = IncludeIneligibleResults;
   Opts.CodeComplete.Limit = LimitResults;
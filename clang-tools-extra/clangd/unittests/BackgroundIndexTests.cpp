@@ -824,6 +824,24 @@ TEST(BackgroundQueueTest, Boost) {
   }
 }
 
+TEST(BackgroundQueueTest, Preempt) {
+  std::atomic<unsigned> Ran(0);
+  BackgroundQueue Q;
+  Q.preempt(std::chrono::hours(1));
+  Q.push(BackgroundQueue::Task([&] { ++Ran; }));
+
+  AsyncTaskRunner ThreadPool;
+  ThreadPool.runAsync("worker", [&] { Q.work(); });
+  EXPECT_FALSE(Q.blockUntilIdleForTest(0.1)) << "task held back";
+  EXPECT_EQ(Ran, 0u);
+
+  Q.preempt(std::chrono::steady_clock::duration::zero());
+  EXPECT_TRUE(Q.blockUntilIdleForTest(10)) << "hold released";
+  EXPECT_EQ(Ran, 1u);
+  Q.stop();
+  ThreadPool.wait();
+}
+
 TEST(BackgroundQueueTest, Duplicates) {
   std::string Sequence;
   BackgroundQueue::Task A([&] { Sequence.push_back('A'); });
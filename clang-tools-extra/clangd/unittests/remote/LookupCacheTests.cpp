@@ -0,0 +1,103 @@
+//===--- LookupCacheTests.cpp ------------------------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "../TestIndex.h"
+#include "index/remote/LookupCache.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace clang {
+namespace clangd {
+namespace remote {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::UnorderedElementsAre;
+
+LookupRequest request(llvm::ArrayRef<SymbolID> IDs) {
+  LookupRequest Req;
+  Req.IDs.insert(IDs.begin(), IDs.end());
+  return Req;
+}
+
+std::vector<std::string> lookupNames(LookupCache &Cache,
+                                     const LookupRequest &Req,
+                                     LookupRequest *Missing = nullptr) {
+  std::vector<std::string> Names;
+  LookupRequest Remaining = Cache.lookup(
+      Req, [&](const Symbol &S) { Names.push_back(S.Name.str()); });
+  if (Missing)
+    *Missing = std::move(Remaining);
+  return Names;
+}
+
+TEST(LookupCacheTest, ReturnsCachedSymbolsAndMissingIDs) {
+  LookupCache Cache(/*MaxSymbols=*/100, std::chrono::minutes(5));
+  Symbol Foo = symbol("ns::foo");
+  Symbol Bar = symbol("ns::bar");
+
+  LookupRequest Missing;
+  EXPECT_THAT(lookupNames(Cache, request({Foo.ID, Bar.ID}), &Missing),
+              IsEmpty());
+  EXPECT_THAT(Missing.IDs, UnorderedElementsAre(Foo.ID, Bar.ID));
+
+  Cache.insert(Foo);
+  EXPECT_THAT(lookupNames(Cache, request({Foo.ID, Bar.ID}), &Missing),
+              ElementsAre("foo"));
+  EXPECT_THAT(Missing.IDs, ElementsAre(Bar.ID));
+}
+
+TEST(LookupCacheTest, CallbackMayReenterCache) {
+  LookupCache Cache(/*MaxSymbols=*/100, std::chrono::minutes(5));
+  Symbol Foo = symbol("ns::foo");
+  Symbol Bar = symbol("ns::bar");
+  Cache.insert(Foo);
+  Cache.insert(Bar);
+
+  std::vector<std::string> Names;
+  Cache.lookup(request({Foo.ID}), [&](const Symbol &S) {
+    Names.push_back(S.Name.str());
+    // This would deadlock if the callback ran under the cache lock.
+    for (const std::string &Name : lookupNames(Cache, request({Bar.ID})))
+      Names.push_back(Name);
+    Cache.insert(symbol("ns::baz"));
+  });
+  EXPECT_THAT(Names, ElementsAre("foo", "bar"));
+}
+
+TEST(LookupCacheTest, DroppedWhenExpired) {
+  LookupCache Cache(/*MaxSymbols=*/100, std::chrono::seconds(0));
+  Symbol Foo = symbol("ns::foo");
+  Cache.insert(Foo);
+
+  LookupRequest Missing;
+  EXPECT_THAT(lookupNames(Cache, request({Foo.ID}), &Missing), IsEmpty());
+  EXPECT_THAT(Missing.IDs, ElementsAre(Foo.ID));
+}
+
+TEST(LookupCacheTest, DroppedWhenFull) {
+  LookupCache Cache(/*MaxSymbols=*/1, std::chrono::minutes(5));
+  Symbol Foo = symbol("ns::foo");
+  Symbol Bar = symbol("ns::bar");
+  Cache.insert(Foo);
+  Cache.insert(Bar);
+
+  LookupRequest Missing;
+  EXPECT_THAT(lookupNames(Cache, request({Foo.ID, Bar.ID}), &Missing),
+              IsEmpty());
+  EXPECT_THAT(Missing.IDs, UnorderedElementsAre(Foo.ID, Bar.ID));
+}
+
+} // namespace
+} // namespace remote
+} // namespace clangd
+} // namespace clang
@@ -189,6 +189,39 @@ TEST_F(CSVMetricsTracerTest, IgnoresArgs) {
   EXPECT_EQ(nullptr, Tracer.Args);
 }
 
+TEST(HistogramTracerTest, Percentiles) {
+  trace::TestTracer Next;
+  trace::HistogramTracer Tracer(&Next);
+  trace::Metric Dist = {"dist", trace::Metric::Distribution, "lbl"};
+  trace::Metric Counter = {"cnt", trace::Metric::Counter};
+  for (unsigned I = 1; I <= 100; ++I) {
+    Tracer.record(Dist, I, "x");
+    Tracer.record(Counter, 1, "");
+  }
+  Tracer.record(Dist, 7, "y");
+
+  auto Snapshot = Tracer.snapshot();
+  auto *Metrics = Snapshot.getAsObject();
+  ASSERT_TRUE(Metrics);
+  EXPECT_EQ(Metrics->get("cnt"), nullptr) << "only distributions are kept";
+  auto *X = Metrics->getObject("dist")->getObject("x");
+  ASSERT_TRUE(X);
+  EXPECT_EQ(X->getInteger("count"), 100);
+  EXPECT_EQ(X->getNumber("max"), 100.0);
+  EXPECT_NEAR(*X->getNumber("mean"), 50.5, 1e-9);
+  // Buckets are 12.5% wide.
+  EXPECT_NEAR(*X->getNumber("p50"), 50, 50 * 0.125);
+  EXPECT_NEAR(*X->getNumber("p90"), 90, 90 * 0.125);
+  EXPECT_NEAR(*X->getNumber("p99"), 99, 99 * 0.125);
+  auto *Y = Metrics->getObject("dist")->getObject("y");
+  ASSERT_TRUE(Y);
+  EXPECT_EQ(Y->getNumber("p50"), 7.0);
+
+  // Everything is forwarded.
+  EXPECT_THAT(Next.takeMetric("dist", "x"), SizeIs(100));
+  EXPECT_THAT(Next.takeMetric("cnt"), SizeIs(100));
+}
+
 } // namespace
 } // namespace clangd
 } // namespace clang
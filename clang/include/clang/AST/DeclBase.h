@@ -1089,6 +1089,9 @@ public:
   static void add(Kind k);
   static void EnableStatistics();
   static void PrintStats();
+  /// Prints the bytes taken by the declarations of \p Ctx, attributed to the
+  /// files that the declarations are written in.
+  static void PrintStatsByFile(const ASTContext &Ctx);
 
   /// isTemplateParameter - Determines whether this declaration is a
   /// template parameter.
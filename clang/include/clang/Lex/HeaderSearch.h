@@ -340,6 +340,11 @@ class HeaderSearch {
   // A map of discovered headers with their associated include file name.
   llvm::DenseMap<const FileEntry *, llvm::SmallString<64>> IncludeNames;
 
+  /// The module file name hashes of module maps, used with
+  /// -fmodules-cache-key-by-content to avoid re-reading the module map every
+  /// time a module file name is formed.
+  llvm::DenseMap<const FileEntry *, uint64_t> ModuleMapContentHashes;
+
   /// Uniqued set of framework names, which is used to track which
   /// headers were included as framework headers.
   llvm::StringSet<llvm::BumpPtrAllocator> FrameworkNames;
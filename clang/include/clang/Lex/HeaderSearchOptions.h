@@ -250,6 +250,18 @@ public:
   LLVM_PREFERRED_TYPE(bool)
   unsigned ModulesHashContent : 1;
 
+  /// Whether the identifiers of imported C++ modules should only be added to
+  /// the identifier table on first lookup, as is always done for C and
+  /// Objective-C.
+  LLVM_PREFERRED_TYPE(bool)
+  unsigned ModulesLazyLoadIdentifiers : 1;
+
+  /// Whether implicitly built module files should be named after the hash of
+  /// their module map contents and its directory relative to the working
+  /// directory, rather than of its path.
+  LLVM_PREFERRED_TYPE(bool)
+  unsigned ModulesCacheKeyByContent : 1;
+
   /// Whether we should include all things that could impact the module in the
   /// hash.
   ///
@@ -271,6 +283,7 @@ public:
         ModulesValidateDiagnosticOptions(true),
         ModulesSkipDiagnosticOptions(false),
         ModulesSkipHeaderSearchPaths(false), ModulesHashContent(false),
+        ModulesLazyLoadIdentifiers(false), ModulesCacheKeyByContent(false),
         ModulesStrictContextHash(false) {}
 
   /// AddPath - Add the \p Path path to the specified \p Group list.
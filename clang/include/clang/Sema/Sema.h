@@ -7385,6 +7385,16 @@ private:
   llvm::ContextualFoldingSet<ConstraintSatisfaction, const ASTContext &>
       SatisfactionCache;
 
+  /// The number of constraint satisfaction checks that were answered from
+  /// \c SatisfactionCache, and that had to be computed.
+  unsigned NumSatisfactionCacheHits = 0;
+  unsigned NumSatisfactionCacheMisses = 0;
+
+  /// The number of class template specializations and function definitions
+  /// instantiated.
+  unsigned NumClassInstantiations = 0;
+  unsigned NumFunctionInstantiations = 0;
+
   /// Introduce the instantiated local variables into the local
   /// instantiation scope.
   void addInstantiatedLocalVarsToScope(FunctionDecl *Function,
@@ -1027,6 +1027,13 @@ private:
   /// The number of lookups into identifier tables that succeed.
   unsigned NumIdentifierLookupHits = 0;
 
+  /// The number of interesting identifiers in the module files loaded so far.
+  unsigned TotalNumPreloadIdentifiers = 0;
+
+  /// The number of interesting identifiers that were added to the identifier
+  /// table eagerly when their module file was loaded.
+  unsigned NumPreloadIdentifiersRead = 0;
+
   /// The number of selectors that have been read.
   unsigned NumSelectorsRead = 0;
 
@@ -12,8 +12,10 @@
 #include "clang/Basic/LLVM.h"
 #include "clang/Lex/DependencyDirectivesScanner.h"
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Support/Allocator.h"
+#include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/VirtualFileSystem.h"
 #include <mutex>
@@ -202,9 +204,57 @@ public:
   CacheShard &getShardForFilename(StringRef Filename) const;
   CacheShard &getShardForUID(llvm::sys::fs::UniqueID UID) const;
 
+  /// Drops the cached entries for the given absolute filenames, including
+  /// stat failures, under any spelling of the path (e.g. "dir/../a.h"), along
+  /// with all other filenames (e.g. symlinks) that resolved to the same
+  /// entries. Worker
+  /// filesystems created before this call may keep seeing the old entries, so
+  /// this must only be called between scans.
+  void invalidateEntries(ArrayRef<StringRef> Filenames);
+
+  /// Enables the persistent directives cache and loads the entries written by
+  /// a previous invocation from \p Path. The entries are keyed by the hash of
+  /// the file contents, so they stay valid when files are touched or moved. A
+  /// missing or stale cache file is not an error; it is treated as empty.
+  llvm::Error loadDirectivesCache(StringRef Path);
+
+  /// Writes the directive tokens of every file that was scanned or found in
+  /// the persistent cache during this invocation to \p Path.
+  llvm::Error writeDirectivesCache(StringRef Path) const;
+
+  /// \returns True if \c loadDirectivesCache() has been called.
+  bool hasDirectivesCache() const { return DirectivesCacheEnabled; }
+
+  /// Looks up the persisted directive tokens for a file with the given
+  /// contents. \returns True and fills \p Tokens and \p Directives on success.
+  bool lookupDirectives(
+      StringRef Contents,
+      SmallVectorImpl<dependency_directives_scan::Token> &Tokens,
+      SmallVectorImpl<dependency_directives_scan::Directive> &Directives);
+
+  /// Records the result of scanning \p Contents so that the next call to
+  /// \c writeDirectivesCache() persists it.
+  void
+  recordDirectives(StringRef Contents,
+                   ArrayRef<dependency_directives_scan::Token> Tokens,
+                   ArrayRef<dependency_directives_scan::Directive> Directives);
+
 private:
   std::unique_ptr<CacheShard[]> CacheShards;
   unsigned NumShards;
+
+  bool DirectivesCacheEnabled = false;
+  /// The contents of the cache file loaded by \c loadDirectivesCache().
+  std::unique_ptr<llvm::MemoryBuffer> DirectivesCacheBuffer;
+  /// Map from content hashes to the encoded records in the loaded buffer.
+  llvm::DenseMap<uint64_t, StringRef> LoadedDirectives;
+
+  /// The mutex that needs to be locked before mutation of the members below.
+  mutable std::mutex DirectivesCacheLock;
+  /// Content hashes of the records in \c PendingDirectives.
+  llvm::DenseSet<uint64_t> RecordedDirectives;
+  /// Encoded records to be written by \c writeDirectivesCache().
+  SmallString<0> PendingDirectives;
 };
 
 /// This class is a local cache, that caches the 'stat' and 'open' calls to the
@@ -33,6 +33,7 @@
 #include "clang/Basic/ObjCRuntime.h"
 #include "clang/Basic/PartialDiagnostic.h"
 #include "clang/Basic/SourceLocation.h"
+#include "clang/Basic/SourceManager.h"
 #include "clang/Basic/TargetInfo.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/PointerIntPair.h"
@@ -199,6 +200,53 @@ void Decl::PrintStats() {
   llvm::errs() << "Total bytes = " << totalBytes << "\n";
 }
 
+static size_t getDeclSize(Decl::Kind K) {
+  switch (K) {
+#define DECL(DERIVED, BASE)                                                    \
+  case Decl::DERIVED:                                                          \
+    return sizeof(DERIVED##Decl);
+#define ABSTRACT_DECL(DECL)
+#include "clang/AST/DeclNodes.inc"
+  }
+  llvm_unreachable("Declaration not in DeclNodes.inc!");
+}
+
+static void collectDeclBytesByFile(const DeclContext *DC,
+                                   const SourceManager &SM,
+                                   llvm::DenseMap<FileID, size_t> &Bytes) {
+  for (const Decl *D : DC->noload_decls()) {
+    FileID FID = SM.getFileID(SM.getExpansionLoc(D->getLocation()));
+    Bytes[FID] += getDeclSize(D->getKind());
+    if (const auto *Inner = dyn_cast<DeclContext>(D))
+      collectDeclBytesByFile(Inner, SM, Bytes);
+  }
+}
+
+void Decl::PrintStatsByFile(const ASTContext &Ctx) {
+  const SourceManager &SM = Ctx.getSourceManager();
+  llvm::DenseMap<FileID, size_t> Bytes;
+  collectDeclBytesByFile(Ctx.getTranslationUnitDecl(), SM, Bytes);
+
+  std::vector<std::pair<FileID, size_t>> Sorted(Bytes.begin(), Bytes.end());
+  llvm::sort(Sorted, [](const auto &LHS, const auto &RHS) {
+    if (LHS.second != RHS.second)
+      return LHS.second > RHS.second;
+    return LHS.first < RHS.first;
+  });
+
+  const unsigned MaxFiles = 20;
+  llvm::errs() << "\n*** Decl Bytes By File (top " << MaxFiles << " of "
+               << Sorted.size() << "):\n";
+  for (const auto &[FID, NumBytes] : ArrayRef(Sorted).take_front(MaxFiles)) {
+    llvm::errs() << "  " << NumBytes << " bytes in ";
+    if (FID.isValid())
+      llvm::errs() << SM.getBufferName(SM.getLocForStartOfFile(FID));
+    else
+      llvm::errs() << "<no location>";
+    llvm::errs() << "\n";
+  }
+}
+
 void Decl::add(Kind k) {
   switch (k) {
 #define DECL(DERIVED, BASE) case DERIVED: ++n##DERIVED##s; break;
@@ -3064,6 +3064,11 @@ void CodeGenModule::EmitDeferred() {
 
   // Grab the list of decls to emit. If EmitGlobalDefinition schedules more
   // work, it will not interfere with this.
+  //
+  // Note that these definitions cannot be emitted in parallel: each one may
+  // create or replace globals in the module, schedule further deferred decls,
+  // and intern types and constants in the (single-threaded) LLVMContext. The
+  // DFS order below is also what keeps the output deterministic.
   std::vector<GlobalDecl> CurDeclsToEmit;
   CurDeclsToEmit.swap(DeferredDeclsToEmit);
 
@@ -4864,9 +4864,37 @@ void Driver::BuildJobs(Compilation &C) const {
 
   // If we have more than one job, then disable integrated-cc1 for now. Do this
   // also when we need to report process execution statistics.
-  if (C.getJobs().size() > 1 || CCPrintProcessStats)
+  //
+  // With -fintegrated-cc1-batch, an invocation made only of cc1 jobs (e.g.
+  // 'clang -c a.c b.c ...') keeps running them in-process, one after another.
+  // Jobs with -mllvm options are excluded since those are parsed into LLVM's
+  // global cl::opt state, and -disable-free is dropped so that one job's AST
+  // doesn't outlive it. The job arguments are scanned rather than the driver
+  // arguments, as the driver adds -mllvm itself for some targets and options,
+  // and -Xclang can forward it too.
+  auto HasLLVMOptions = [](const Command &J) {
+    return llvm::any_of(J.getArguments(), [](const char *Arg) {
+      return StringRef(Arg) == "-mllvm";
+    });
+  };
+  bool BatchInProcess =
+      C.getArgs().hasArg(options::OPT_fintegrated_cc1_batch) &&
+      C.getJobs().size() > 1 &&
+      llvm::all_of(C.getJobs(), [&](const Command &J) {
+        return J.InProcess && !HasLLVMOptions(J);
+      });
+  if (BatchInProcess && !CCPrintProcessStats) {
+    for (auto &J : C.getJobs()) {
+      llvm::opt::ArgStringList Args;
+      for (const char *Arg : J.getArguments())
+        if (StringRef(Arg) != "-disable-free")
+          Args.push_back(Arg);
+      J.replaceArguments(std::move(Args));
+    }
+  } else if (C.getJobs().size() > 1 || CCPrintProcessStats) {
     for (auto &J : C.getJobs())
       J.InProcess = false;
+  }
 
   if (CCPrintProcessStats) {
     C.setPostCallback([=](const Command &Cmd, int Res) {
@@ -2410,6 +2410,9 @@ public:
     tooling::Replacements Result;
     deriveLocalStyle(AnnotatedLines);
     AffectedRangeMgr.computeAffectedLines(AnnotatedLines);
+    // Unaffected lines are annotated too, even with -lines: the derived
+    // pointer alignment, line merging and the WhitespaceManager alignment
+    // passes all read formatting information from neighbouring lines.
     for (AnnotatedLine *Line : AnnotatedLines)
       Annotator.calculateFormattingInformation(*Line);
     Annotator.setCommentLineLevels(AnnotatedLines);
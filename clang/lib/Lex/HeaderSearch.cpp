@@ -37,6 +37,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/VirtualFileSystem.h"
+#include "llvm/Support/xxhash.h"
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
@@ -256,14 +257,52 @@ std::string HeaderSearch::getCachedModuleFileNameImpl(StringRef ModuleName,
     //
     // To avoid false-negatives, we form as canonical a path as we can, and map
     // to lower-case in case we're on a case-insensitive file system.
-    SmallString<128> CanonicalPath(ModuleMapPath);
-    if (getModuleMap().canonicalizeModuleMapPath(CanonicalPath))
-      return {};
-
-    llvm::hash_code Hash = llvm::hash_combine(CanonicalPath.str().lower());
+    //
+    // With -fmodules-cache-key-by-content, the contents of the module map are
+    // hashed instead, so that identical checkouts in different directories
+    // share the module file. Headers are resolved relative to the module map,
+    // so identical module maps in different directories of one checkout are
+    // different modules; the directory of the module map, relative to the
+    // working directory if it is inside it, is hashed as well. The module file
+    // is still validated against the module map and inputs found by the
+    // importer, so this is only profitable when the module file records
+    // relocatable paths.
+    uint64_t Hash;
+    if (HSOpts->ModulesCacheKeyByContent) {
+      OptionalFileEntryRef ModuleMapFile =
+          getFileMgr().getOptionalFileRef(ModuleMapPath);
+      if (!ModuleMapFile)
+        return {};
+      auto Known = ModuleMapContentHashes.find(&ModuleMapFile->getFileEntry());
+      if (Known != ModuleMapContentHashes.end()) {
+        Hash = Known->second;
+      } else {
+        auto Buffer = getFileMgr().getBufferForFile(*ModuleMapFile);
+        if (!Buffer)
+          return {};
+        SmallString<128> Dir(ModuleMapFile->getDir().getName());
+        getFileMgr().makeAbsolutePath(Dir);
+        llvm::sys::path::remove_dots(Dir, /*remove_dot_dot=*/true);
+        StringRef DirKey = Dir;
+        llvm::ErrorOr<std::string> CWD =
+            getFileMgr().getVirtualFileSystem().getCurrentWorkingDirectory();
+        StringRef RelDir = Dir;
+        if (CWD && RelDir.consume_front(*CWD) &&
+            (RelDir.empty() || llvm::sys::path::is_separator(RelDir.front())))
+          DirKey = RelDir;
+        Hash = size_t(llvm::hash_combine(
+            llvm::xxh3_64bits((*Buffer)->getBuffer()), DirKey));
+        ModuleMapContentHashes[&ModuleMapFile->getFileEntry()] = Hash;
+      }
+    } else {
+      SmallString<128> CanonicalPath(ModuleMapPath);
+      if (getModuleMap().canonicalizeModuleMapPath(CanonicalPath))
+        return {};
+      Hash = size_t(llvm::hash_combine(CanonicalPath.str().lower()));
+    }
 
     SmallString<128> HashStr;
-    llvm::APInt(64, size_t(Hash)).toStringUnsigned(HashStr, /*Radix*/36);
+    llvm::APInt(64, Hash).toStringUnsigned(HashStr, /*Radix*/36);
     llvm::sys::path::append(Result, ModuleName + "-" + HashStr + ".pcm");
   }
   return Result.str().str();
@@ -1465,6 +1504,12 @@ bool HeaderSearch::ShouldEnterIncludeFile(Preprocessor &PP,
 
   // Next, check to see if the file is wrapped with #ifndef guards.  If so, and
   // if the macro that guards it is defined, we know the #include has no effect.
+  //
+  // Note that the controlling macro is only known once the file has been
+  // lexed in this translation unit (or comes from an AST file), and keeping it
+  // in a cache shared across translation units would not help: on the first
+  // #include of a header in a fresh translation unit its guard is normally
+  // not defined yet, so the file has to be entered regardless.
   if (const IdentifierInfo *ControllingMacro
       = FileInfo.getControllingMacro(ExternalLookup)) {
     // If the header corresponds to a module, check whether the macro is already
@@ -2771,6 +2771,8 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
 #elif __ALTIVEC__
 #include <altivec.h>
 #undef bool
+#elif defined(__aarch64__) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_neon.h>
 #endif
 
 /// We have just read from input the / and * characters that started a comment.
@@ -2874,6 +2876,27 @@ bool Lexer::SkipBlockComment(Token &Result, const char *CurPtr,
         CurPtr += 16;
       }
 
+#elif defined(__aarch64__) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+      uint8x16_t Slashes = vdupq_n_u8('/');
+      while (CurPtr + 16 < BufferEnd) {
+        uint8x16_t Chars = vld1q_u8((const uint8_t *)CurPtr);
+        if (LLVM_UNLIKELY(vmaxvq_u8(Chars) >= 0x80))
+          goto MultiByteUTF8;
+        // look for slashes
+        uint8x16_t Cmp = vceqq_u8(Chars, Slashes);
+        if (vmaxvq_u8(Cmp) != 0) {
+          // Narrow the comparison result to 4 bits per byte to find the index
+          // of the first slash, and point directly after it. This relies on
+          // little-endian lane order, hence the __ARM_BIG_ENDIAN check above.
+          uint64_t Mask = vget_lane_u64(
+              vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Cmp), 4)),
+              0);
+          CurPtr += llvm::countr_zero(Mask) / 4 + 1;
+          goto FoundSlash;
+        }
+        CurPtr += 16;
+      }
+
 #else
       while (CurPtr + 16 < BufferEnd) {
         bool HasNonASCII = false;
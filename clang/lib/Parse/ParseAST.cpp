@@ -188,6 +188,7 @@ void clang::ParseAST(Sema &S, bool PrintStats, bool SkipFunctionBodies) {
     if (HaveLexer) P.getActions().PrintStats();
     S.getASTContext().PrintStats();
     Decl::PrintStats();
+    Decl::PrintStatsByFile(S.getASTContext());
     Stmt::PrintStats();
     Consumer->PrintStats();
   }
@@ -564,6 +564,18 @@ void Sema::addExternalSource(ExternalSemaSource *E) {
 void Sema::PrintStats() const {
   llvm::errs() << "\n*** Semantic Analysis Stats:\n";
   llvm::errs() << NumSFINAEErrors << " SFINAE diagnostics trapped.\n";
+  llvm::errs() << NumClassInstantiations << " class templates instantiated.\n";
+  llvm::errs() << NumFunctionInstantiations
+               << " function definitions instantiated.\n";
+  unsigned NumSatisfactionChecks =
+      NumSatisfactionCacheHits + NumSatisfactionCacheMisses;
+  llvm::errs() << NumSatisfactionCacheHits << "/" << NumSatisfactionChecks
+               << " constraint satisfaction checks answered from cache";
+  if (NumSatisfactionChecks)
+    llvm::errs() << " ("
+                 << 100 * NumSatisfactionCacheHits / NumSatisfactionChecks
+                 << "%)";
+  llvm::errs() << ".\n";
 
   BumpAlloc.PrintStats();
   AnalysisWarnings.PrintStats();
@@ -29,6 +29,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/PointerUnion.h"
 #include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/TimeProfiler.h"
 #include <optional>
 
 using namespace clang;
@@ -500,9 +501,19 @@ bool Sema::CheckConstraintSatisfaction(
   ConstraintSatisfaction::Profile(ID, Context, Template, FlattenedArgs);
   void *InsertPos;
   if (auto *Cached = SatisfactionCache.FindNodeOrInsertPos(ID, InsertPos)) {
+    ++NumSatisfactionCacheHits;
     OutSatisfaction = *Cached;
     return false;
   }
+  ++NumSatisfactionCacheMisses;
+
+  llvm::TimeTraceScope TimeScope("CheckConstraintSatisfaction", [&]() {
+    std::string Name;
+    llvm::raw_string_ostream OS(Name);
+    Template->getNameForDiagnostic(OS, getPrintingPolicy(),
+                                   /*Qualified=*/true);
+    return Name;
+  });
 
   auto Satisfaction =
       std::make_unique<ConstraintSatisfaction>(Template, FlattenedArgs);
@@ -3226,6 +3226,7 @@ Sema::InstantiateClass(SourceLocation PointOfInstantiation,
                                         /*Qualified=*/true);
     return Name;
   });
+  ++NumClassInstantiations;
 
   Pattern = PatternDef;
 
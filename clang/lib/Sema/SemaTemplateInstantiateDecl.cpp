@@ -4967,6 +4967,7 @@ void Sema::InstantiateFunctionDefinition(SourceLocation PointOfInstantiation,
                                    /*Qualified=*/true);
     return Name;
   });
+  ++NumFunctionInstantiations;
 
   // If we're performing recursive template instantiation, create our own
   // queue of pending implicit instantiations that we will instantiate later,
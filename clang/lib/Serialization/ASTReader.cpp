@@ -4493,6 +4493,9 @@ ASTReader::ASTReadResult ASTReader::ReadAST(StringRef FileName, ModuleKind Type,
   }
 
   // Preload source locations and interesting indentifiers.
+  bool LazyLoadIdentifiers =
+      !PP.getLangOpts().CPlusPlus ||
+      PP.getHeaderSearchInfo().getHeaderSearchOpts().ModulesLazyLoadIdentifiers;
   for (ImportedModule &M : Loaded) {
     ModuleFile &F = *M.Mod;
 
@@ -4501,6 +4504,7 @@ ASTReader::ASTReadResult ASTReader::ReadAST(StringRef FileName, ModuleKind Type,
     if (F.OriginalSourceFileID.isValid())
       F.OriginalSourceFileID = TranslateFileID(F, F.OriginalSourceFileID);
 
+    TotalNumPreloadIdentifiers += F.PreloadIdentifierOffsets.size();
     for (auto Offset : F.PreloadIdentifierOffsets) {
       const unsigned char *Data = F.IdentifierTableData + Offset;
 
@@ -4509,7 +4513,7 @@ ASTReader::ASTReadResult ASTReader::ReadAST(StringRef FileName, ModuleKind Type,
       auto Key = Trait.ReadKey(Data, KeyDataLen.first);
 
       IdentifierInfo *II;
-      if (!PP.getLangOpts().CPlusPlus) {
+      if (LazyLoadIdentifiers) {
         // Identifiers present in both the module file and the importing
         // instance are marked out-of-date so that they can be deserialized
         // on next use via ASTReader::updateOutOfDateIdentifier().
@@ -4526,9 +4530,12 @@ ASTReader::ASTReadResult ASTReader::ReadAST(StringRef FileName, ModuleKind Type,
         // table of the importing instance and marked as out-of-date. This makes
         // ASTReader::get() a no-op, and deserialization will take place on
         // first/next use via ASTReader::updateOutOfDateIdentifier().
+        // -fmodules-lazy-load-identifiers opts into the behavior above when
+        // importing many modules makes this eager step expensive.
         II = &PP.getIdentifierTable().getOwn(Key);
       }
 
+      ++NumPreloadIdentifiersRead;
       II->setOutOfDate(true);
 
       // Mark this identifier as being from an AST file so that we can track
@@ -8048,6 +8055,11 @@ void ASTReader::PrintStats() {
     std::fprintf(stderr, "  %u/%u identifiers read (%f%%)\n",
                  NumIdentifiersLoaded, (unsigned)IdentifiersLoaded.size(),
                  ((float)NumIdentifiersLoaded/IdentifiersLoaded.size() * 100));
+  if (TotalNumPreloadIdentifiers)
+    std::fprintf(stderr, "  %u/%u interesting identifiers preloaded (%f%%)\n",
+                 NumPreloadIdentifiersRead, TotalNumPreloadIdentifiers,
+                 ((float)NumPreloadIdentifiersRead/TotalNumPreloadIdentifiers
+                  * 100));
   if (!MacrosLoaded.empty())
     std::fprintf(stderr, "  %u/%u macros read (%f%%)\n",
                  NumMacrosLoaded, (unsigned)MacrosLoaded.size(),
@@ -451,6 +451,12 @@ void AnalysisConsumer::HandleDeclsCallGraph(const unsigned LocalTUDeclsSize) {
   // inlined functions. The topological order allows the "do not reanalyze
   // previously inlined function" performance heuristic to be triggered more
   // often.
+  //
+  // This walk is inherently serial: the Visited set makes each function's
+  // analysis depend on the ones before it, and both the engine and CTU
+  // imports allocate into and modify the shared ASTContext. The CTU side
+  // already caches loaded ASTs and imported definitions for the whole TU
+  // (see CrossTranslationUnitContext).
   SetOfConstDecls Visited;
   SetOfConstDecls VisitedAsTopLevel;
   llvm::ReversePostOrderTraversal<clang::CallGraph*> RPOT(&CG);
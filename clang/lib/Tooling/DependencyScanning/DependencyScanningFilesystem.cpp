@@ -7,9 +7,15 @@
 //===----------------------------------------------------------------------===//
 
 #include "clang/Tooling/DependencyScanning/DependencyScanningFilesystem.h"
+#include "clang/Basic/TokenKinds.h"
+#include "clang/Basic/Version.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/StringSet.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/SmallVectorMemoryBuffer.h"
 #include "llvm/Support/Threading.h"
+#include "llvm/Support/xxhash.h"
 #include <optional>
 
 using namespace clang;
@@ -61,10 +67,19 @@ EntryRef DependencyScanningWorkerFilesystem::scanForDirectivesIfNecessary(
     return EntryRef(Filename, Entry);
 
   SmallVector<dependency_directives_scan::Directive, 64> Directives;
+  StringRef Source = Contents->Original->getBuffer();
+  bool UseDirectivesCache = SharedCache.hasDirectivesCache();
+  if (UseDirectivesCache && SharedCache.lookupDirectives(
+                                Source, Contents->DepDirectiveTokens,
+                                Directives)) {
+    Contents->DepDirectives.store(
+        new std::optional<DependencyDirectivesTy>(std::move(Directives)));
+    return EntryRef(Filename, Entry);
+  }
+
   // Scan the file for preprocessor directives that might affect the
   // dependencies.
-  if (scanSourceForDependencyDirectives(Contents->Original->getBuffer(),
-                                        Contents->DepDirectiveTokens,
+  if (scanSourceForDependencyDirectives(Source, Contents->DepDirectiveTokens,
                                         Directives)) {
     Contents->DepDirectiveTokens.clear();
     // FIXME: Propagate the diagnostic if desired by the client.
@@ -72,6 +87,10 @@ EntryRef DependencyScanningWorkerFilesystem::scanForDirectivesIfNecessary(
     return EntryRef(Filename, Entry);
   }
 
+  if (UseDirectivesCache)
+    SharedCache.recordDirectives(Source, Contents->DepDirectiveTokens,
+                                 Directives);
+
   // This function performed double-checked locking using `DepDirectives`.
   // Assigning it must be the last thing this function does, otherwise other
   // threads may skip the
@@ -107,6 +126,218 @@ DependencyScanningFilesystemSharedCache::getShardForUID(
   return CacheShards[Hash % NumShards];
 }
 
+/// Returns \p Filename with "." and ".." components removed, so that different
+/// spellings of the same absolute path compare equal.
+static SmallString<256> normalizeFilename(StringRef Filename) {
+  SmallString<256> Normalized(Filename);
+  llvm::sys::path::remove_dots(Normalized, /*remove_dot_dot=*/true);
+  return Normalized;
+}
+
+void DependencyScanningFilesystemSharedCache::invalidateEntries(
+    ArrayRef<StringRef> Filenames) {
+  llvm::StringSet<> NormalizedFilenames;
+  for (StringRef Filename : Filenames)
+    NormalizedFilenames.insert(normalizeFilename(Filename));
+
+  // Entries may be cached under any spelling of their path (e.g. "dir/../a.h"),
+  // and stat failures have no unique ID to match on, so compare the normalized
+  // spellings of all cached filenames.
+  llvm::DenseSet<const CachedFileSystemEntry *> StaleEntries;
+  for (unsigned I = 0; I != NumShards; ++I) {
+    CacheShard &Shard = CacheShards[I];
+    std::lock_guard<std::mutex> LockGuard(Shard.CacheLock);
+    for (const auto &Entry : Shard.EntriesByFilename)
+      if (Entry.getValue() &&
+          NormalizedFilenames.contains(normalizeFilename(Entry.getKey())))
+        StaleEntries.insert(Entry.getValue());
+  }
+  if (StaleEntries.empty())
+    return;
+
+  // The entries themselves stay allocated until the cache is destroyed; only
+  // the mappings leading to them are removed. This also drops other filenames
+  // (e.g. symlinks) that resolved to the same entries.
+  for (unsigned I = 0; I != NumShards; ++I) {
+    CacheShard &Shard = CacheShards[I];
+    std::lock_guard<std::mutex> LockGuard(Shard.CacheLock);
+    for (auto It = Shard.EntriesByFilename.begin(),
+              End = Shard.EntriesByFilename.end();
+         It != End;) {
+      auto Current = It++;
+      if (StaleEntries.contains(Current->getValue()))
+        Shard.EntriesByFilename.erase(Current);
+    }
+    for (auto It = Shard.EntriesByUID.begin(), End = Shard.EntriesByUID.end();
+         It != End;) {
+      auto Current = It++;
+      if (StaleEntries.contains(Current->getSecond()))
+        Shard.EntriesByUID.erase(Current);
+    }
+  }
+}
+
+// The persistent directives cache starts with a header identifying the format
+// and the compiler that wrote it, followed by one record per file:
+//
+//   u64 content hash, u32 content size, u32 #tokens, u32 #directives,
+//   #tokens    x { u32 offset, u32 length, u16 kind, u16 flags },
+//   #directives x { u32 #tokens, u8 kind }
+//
+// All integers are little-endian. Token offsets are relative to the file
+// contents, so a record can be reused for any file with the same contents.
+static constexpr llvm::StringLiteral DirectivesCacheMagic = "CSDC";
+static constexpr uint32_t DirectivesCacheVersion = 1;
+static constexpr size_t DirectivesRecordHeaderSize = 8 + 4 + 4 + 4;
+static constexpr size_t DirectivesTokenSize = 4 + 4 + 2 + 2;
+static constexpr size_t DirectivesDirectiveSize = 4 + 1;
+
+static uint64_t getDirectivesCacheKey(StringRef Contents) {
+  uint64_t Hash = llvm::xxh3_64bits(Contents);
+  // Keep clear of the empty and tombstone keys of the DenseMap.
+  if (Hash >= llvm::DenseMapInfo<uint64_t>::getTombstoneKey())
+    Hash = 0;
+  return Hash;
+}
+
+static std::string getDirectivesCacheHeader() {
+  std::string Header;
+  llvm::raw_string_ostream OS(Header);
+  llvm::support::endian::Writer W(OS, llvm::endianness::little);
+  std::string ClangVersion = getClangFullVersion();
+  OS << DirectivesCacheMagic;
+  W.write<uint32_t>(DirectivesCacheVersion);
+  W.write<uint32_t>(ClangVersion.size());
+  OS << ClangVersion;
+  return Header;
+}
+
+llvm::Error
+DependencyScanningFilesystemSharedCache::loadDirectivesCache(StringRef Path) {
+  DirectivesCacheEnabled = true;
+  auto MaybeBuffer =
+      llvm::MemoryBuffer::getFile(Path, /*IsText=*/false,
+                                  /*RequiresNullTerminator=*/false);
+  if (!MaybeBuffer) {
+    if (MaybeBuffer.getError() == std::errc::no_such_file_or_directory)
+      return llvm::Error::success();
+    return llvm::createFileError(Path, MaybeBuffer.getError());
+  }
+
+  StringRef Data = (*MaybeBuffer)->getBuffer();
+  std::string Header = getDirectivesCacheHeader();
+  if (!Data.consume_front(Header))
+    return llvm::Error::success();
+
+  // Index the records, ignoring a truncated tail.
+  using namespace llvm::support::endian;
+  while (Data.size() >= DirectivesRecordHeaderSize) {
+    const char *P = Data.data();
+    uint64_t Hash = read64le(P);
+    size_t RecordSize = DirectivesRecordHeaderSize +
+                        uint64_t(read32le(P + 12)) * DirectivesTokenSize +
+                        uint64_t(read32le(P + 16)) * DirectivesDirectiveSize;
+    if (RecordSize > Data.size())
+      break;
+    LoadedDirectives.try_emplace(Hash, Data.take_front(RecordSize));
+    Data = Data.drop_front(RecordSize);
+  }
+  DirectivesCacheBuffer = std::move(*MaybeBuffer);
+  return llvm::Error::success();
+}
+
+llvm::Error DependencyScanningFilesystemSharedCache::writeDirectivesCache(
+    StringRef Path) const {
+  std::lock_guard<std::mutex> LockGuard(DirectivesCacheLock);
+  return llvm::writeToOutput(Path, [&](llvm::raw_ostream &OS) {
+    OS << getDirectivesCacheHeader() << PendingDirectives;
+    return llvm::Error::success();
+  });
+}
+
+bool DependencyScanningFilesystemSharedCache::lookupDirectives(
+    StringRef Contents,
+    SmallVectorImpl<dependency_directives_scan::Token> &Tokens,
+    SmallVectorImpl<dependency_directives_scan::Directive> &Directives) {
+  uint64_t Hash = getDirectivesCacheKey(Contents);
+  auto It = LoadedDirectives.find(Hash);
+  if (It == LoadedDirectives.end())
+    return false;
+
+  using namespace llvm::support::endian;
+  StringRef Record = It->second;
+  const char *P = Record.data();
+  if (read32le(P + 8) != Contents.size())
+    return false;
+  unsigned NumTokens = read32le(P + 12);
+  unsigned NumDirectives = read32le(P + 16);
+  P += DirectivesRecordHeaderSize;
+
+  // Validate everything before handing the tokens to the lexer; a corrupted
+  // record must not turn into out-of-bounds reads of the file contents.
+  Tokens.clear();
+  Tokens.reserve(NumTokens);
+  for (unsigned I = 0; I != NumTokens; ++I, P += DirectivesTokenSize) {
+    uint64_t Offset = read32le(P);
+    uint64_t Length = read32le(P + 4);
+    uint16_t Kind = read16le(P + 8);
+    if (Offset + Length > Contents.size() || Kind >= tok::NUM_TOKENS) {
+      Tokens.clear();
+      return false;
+    }
+    Tokens.emplace_back(Offset, Length, tok::TokenKind(Kind), read16le(P + 10));
+  }
+
+  ArrayRef<dependency_directives_scan::Token> Remaining = Tokens;
+  Directives.clear();
+  Directives.reserve(NumDirectives);
+  for (unsigned I = 0; I != NumDirectives; ++I, P += DirectivesDirectiveSize) {
+    uint32_t Count = read32le(P);
+    uint8_t Kind = P[4];
+    if (Count > Remaining.size() || Kind > dependency_directives_scan::pp_eof) {
+      Tokens.clear();
+      Directives.clear();
+      return false;
+    }
+    Directives.emplace_back(dependency_directives_scan::DirectiveKind(Kind),
+                            Remaining.take_front(Count));
+    Remaining = Remaining.drop_front(Count);
+  }
+
+  // Carry the record over into the cache written by this invocation.
+  std::lock_guard<std::mutex> LockGuard(DirectivesCacheLock);
+  if (RecordedDirectives.insert(Hash).second)
+    PendingDirectives += Record;
+  return true;
+}
+
+void DependencyScanningFilesystemSharedCache::recordDirectives(
+    StringRef Contents, ArrayRef<dependency_directives_scan::Token> Tokens,
+    ArrayRef<dependency_directives_scan::Directive> Directives) {
+  uint64_t Hash = getDirectivesCacheKey(Contents);
+  SmallString<256> Record;
+  llvm::raw_svector_ostream OS(Record);
+  llvm::support::endian::Writer W(OS, llvm::endianness::little);
+  W.write<uint64_t>(Hash);
+  W.write<uint32_t>(Contents.size());
+  W.write<uint32_t>(Tokens.size());
+  W.write<uint32_t>(Directives.size());
+  for (const dependency_directives_scan::Token &T : Tokens) {
+    W.write<uint32_t>(T.Offset);
+    W.write<uint32_t>(T.Length);
+    W.write<uint16_t>(T.Kind);
+    W.write<uint16_t>(T.Flags);
+  }
+  for (const dependency_directives_scan::Directive &D : Directives) {
+    W.write<uint32_t>(D.Tokens.size());
+    W.write<uint8_t>(D.Kind);
+  }
+
+  std::lock_guard<std::mutex> LockGuard(DirectivesCacheLock);
+  if (RecordedDirectives.insert(Hash).second)
+    PendingDirectives += Record;
+}
+
 const CachedFileSystemEntry *
 DependencyScanningFilesystemSharedCache::CacheShard::findEntryByFilename(
     StringRef Filename) const {
@@ -0,0 +1,177 @@
+; Check that -asan-random-rate decides per function whether to keep the access
+; checks, rather than keeping or dropping those of every function together.
+;
+; RUN: %clang_cc1 -triple x86_64-unknown-unknown -S -emit-llvm -o - \
+; RUN:   -fsanitize=address -mllvm -asan-instrumentation-with-call-threshold=0 \
+; RUN:   %s | grep -c 'call void @__asan_load4(' | FileCheck %s --check-prefix=ALL
+; RUN: %clang_cc1 -triple x86_64-unknown-unknown -S -emit-llvm -o - \
+; RUN:   -fsanitize=address -mllvm -asan-instrumentation-with-call-threshold=0 \
+; RUN:   -mllvm -asan-random-rate=0.5 \
+; RUN:   %s | grep -c 'call void @__asan_load4(' | FileCheck %s --check-prefix=SOME
+; RUN: %clang_cc1 -triple x86_64-unknown-unknown -S -emit-llvm -o - \
+; RUN:   -fsanitize=address -mllvm -asan-instrumentation-with-call-threshold=0 \
+; RUN:   -mllvm -asan-random-rate=0 %s | FileCheck %s --check-prefix=NONE
+
+; ALL: {{^32$}}
+; SOME: {{^([1-9]|[12][0-9]|3[01])$}}
+; NONE-NOT: call void @__asan_load4(
+
+define i32 @f0(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f1(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f2(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f3(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f4(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f5(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f6(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f7(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f8(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f9(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f10(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f11(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f12(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f13(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f14(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f15(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f16(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f17(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f18(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f19(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f20(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f21(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f22(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f23(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f24(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f25(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f26(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f27(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f28(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f29(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f30(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define i32 @f31(ptr %p) sanitize_address {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
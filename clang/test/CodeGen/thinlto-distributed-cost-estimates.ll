@@ -0,0 +1,52 @@
+; REQUIRES: x86-registered-target
+
+;; Check the .thinlto.cost files written by distributed ThinLTO with
+;; -thinlto-emit-cost-estimates. Aliases are not counted as functions of their
+;; own.
+
+; RUN: split-file %s %t
+; RUN: opt -module-summary %t/main.ll -o %t/main.bc
+; RUN: opt -module-summary %t/foo.ll -o %t/foo.bc
+
+; RUN: llvm-lto2 run -thinlto-distributed-indexes -thinlto-emit-cost-estimates \
+; RUN:   %t/main.bc %t/foo.bc -o %t/out \
+; RUN:   -r=%t/main.bc,main,plx \
+; RUN:   -r=%t/main.bc,foo, \
+; RUN:   -r=%t/foo.bc,foo,pl \
+; RUN:   -r=%t/foo.bc,foo_alias,pl
+
+; RUN: FileCheck %s --check-prefix=MAIN < %t/main.bc.thinlto.cost
+; RUN: FileCheck %s --check-prefix=FOO < %t/foo.bc.thinlto.cost
+
+; MAIN:      functions: 1
+; MAIN-NEXT: instructions: 2
+; MAIN-NEXT: imported-functions: 1
+; MAIN-NEXT: imported-instructions: 3
+
+; FOO:      functions: 1
+; FOO-NEXT: instructions: 3
+; FOO-NEXT: imported-functions: 0
+; FOO-NEXT: imported-instructions: 0
+
+;--- main.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+declare i32 @foo(i32)
+
+define i32 @main() {
+  %r = call i32 @foo(i32 1)
+  ret i32 %r
+}
+
+;--- foo.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+@foo_alias = alias i32 (i32), ptr @foo
+
+define i32 @foo(i32 %x) {
+  %a = add i32 %x, 1
+  %b = mul i32 %a, 3
+  ret i32 %b
+}
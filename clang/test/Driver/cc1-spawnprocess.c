@@ -46,3 +46,19 @@
 // RUN: echo > %t.s
 // RUN: %clang --target=x86_64-linux -fintegrated-cc1 -fintegrated-as -c -### %t.s 2>&1 | FileCheck %s --check-prefix=YES
 // RUN: %clang --target=x86_64-linux -fno-integrated-cc1 -c -### %t.s 2>&1 | FileCheck %s --check-prefix=NO
+
+// With -fintegrated-cc1-batch, the three cc1 jobs run in-process.
+// RUN: %clang -fintegrated-cc1 -fintegrated-cc1-batch -fintegrated-as -c \
+// RUN:     %t1.cpp %t2.cpp %t3.cpp -### 2>&1 | FileCheck %s --check-prefix=YES
+
+// Jobs with -mllvm options are not batched, whether the option comes from the
+// command line, from -Xclang, or is added by the driver itself.
+// RUN: %clang -fintegrated-cc1 -fintegrated-cc1-batch -fintegrated-as -c \
+// RUN:     -mllvm -debug-pass=Arguments %t1.cpp %t2.cpp -### 2>&1 \
+// RUN:     | FileCheck %s --check-prefix=NO
+// RUN: %clang -fintegrated-cc1 -fintegrated-cc1-batch -fintegrated-as -c \
+// RUN:     -Xclang -mllvm -Xclang -debug-pass=Arguments %t1.cpp %t2.cpp \
+// RUN:     -### 2>&1 | FileCheck %s --check-prefix=NO
+// RUN: %clang --target=armv7-linux-gnueabi -fintegrated-cc1 \
+// RUN:     -fintegrated-cc1-batch -fintegrated-as -mno-global-merge -c \
+// RUN:     %t1.cpp %t2.cpp -### 2>&1 | FileCheck %s --check-prefix=NO
@@ -0,0 +1,37 @@
+// Check that with -fmodules-cache-key-by-content, byte-identical module maps
+// in different directories still get different module files, since their
+// headers are resolved relative to the module map.
+//
+// RUN: rm -rf %t
+// RUN: split-file %s %t
+//
+// RUN: %clang_cc1 -std=c++17 -fmodules -fimplicit-module-maps \
+// RUN:   -fmodules-cache-key-by-content -fmodules-cache-path=%t/cache \
+// RUN:   -I %t/dir1 %t/use.cpp -DEXPECTED=1 -verify
+// RUN: %clang_cc1 -std=c++17 -fmodules -fimplicit-module-maps \
+// RUN:   -fmodules-cache-key-by-content -fmodules-cache-path=%t/cache \
+// RUN:   -I %t/dir2 %t/use.cpp -DEXPECTED=2 -verify
+// RUN: find %t/cache -name 'A-*.pcm' | count 2
+//
+// Using the first module map again still finds its own module file.
+// RUN: %clang_cc1 -std=c++17 -fmodules -fimplicit-module-maps \
+// RUN:   -fmodules-cache-key-by-content -fmodules-cache-path=%t/cache \
+// RUN:   -I %t/dir1 %t/use.cpp -DEXPECTED=1 -verify
+// RUN: find %t/cache -name 'A-*.pcm' | count 2
+
+//--- dir1/module.modulemap
+module A { header "a.h" }
+
+//--- dir1/a.h
+#define VALUE 1
+
+//--- dir2/module.modulemap
+module A { header "a.h" }
+
+//--- dir2/a.h
+#define VALUE 2
+
+//--- use.cpp
+// expected-no-diagnostics
+#include "a.h"
+static_assert(VALUE == EXPECTED, "");
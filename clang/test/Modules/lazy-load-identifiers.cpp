@@ -0,0 +1,57 @@
+// Check that identifiers, macros and #undefs from an imported C++ module
+// resolve the same way with -fmodules-lazy-load-identifiers as with the
+// default eager preloading.
+//
+// RUN: rm -rf %t
+// RUN: split-file %s %t
+//
+// RUN: %clang_cc1 -std=c++17 -fmodules -fimplicit-module-maps \
+// RUN:   -fmodules-cache-path=%t/cache-eager -I %t %t/use.cpp -verify
+// RUN: %clang_cc1 -std=c++17 -fmodules -fimplicit-module-maps \
+// RUN:   -fmodules-cache-path=%t/cache-lazy -fmodules-lazy-load-identifiers \
+// RUN:   -I %t %t/use.cpp -verify
+//
+// RUN: %clang_cc1 -std=c++17 -fmodules -fimplicit-module-maps \
+// RUN:   -fmodules-cache-path=%t/cache-eager -I %t %t/use.cpp \
+// RUN:   -ast-print -o %t/eager.txt
+// RUN: %clang_cc1 -std=c++17 -fmodules -fimplicit-module-maps \
+// RUN:   -fmodules-cache-path=%t/cache-lazy -fmodules-lazy-load-identifiers \
+// RUN:   -I %t %t/use.cpp -ast-print -o %t/lazy.txt
+// RUN: diff %t/eager.txt %t/lazy.txt
+
+//--- module.modulemap
+module A { header "a.h" }
+
+//--- a.h
+#define LAZY_VALUE 42
+#define LAZY_CALL(x) lazy_function(x)
+#define LAZY_REMOVED 1
+#undef LAZY_REMOVED
+
+namespace lazy_ns {
+struct LazyType {
+  int lazy_member;
+};
+} // namespace lazy_ns
+
+inline int lazy_function(int x) { return x + LAZY_VALUE; }
+
+//--- use.cpp
+// expected-no-diagnostics
+#include "a.h"
+
+#ifndef LAZY_VALUE
+#error LAZY_VALUE should be visible
+#endif
+#ifdef LAZY_REMOVED
+#error LAZY_REMOVED was undefined by the module
+#endif
+
+static_assert(LAZY_VALUE == 42, "");
+
+#undef LAZY_VALUE
+#ifdef LAZY_VALUE
+#error LAZY_VALUE was undefined by the importer
+#endif
+
+int use(lazy_ns::LazyType T) { return LAZY_CALL(T.lazy_member); }
@@ -29,6 +29,7 @@
 #include "llvm/Support/Threading.h"
 #include "llvm/Support/Timer.h"
 #include "llvm/TargetParser/Host.h"
+#include <cstdio>
 #include <mutex>
 #include <optional>
 #include <thread>
@@ -76,6 +77,7 @@ enum ResourceDirRecipeKind {
 static ScanningMode ScanMode = ScanningMode::DependencyDirectivesScan;
 static ScanningOutputFormat Format = ScanningOutputFormat::Make;
 static std::string ModuleFilesDir;
+static std::string DirectivesCachePath;
 static bool OptimizeArgs;
 static bool EagerLoadModules;
 static unsigned NumThreads = 0;
@@ -86,6 +88,7 @@ static bool DeprecatedDriverCommand;
 static ResourceDirRecipeKind ResourceDirRecipe;
 static bool Verbose;
 static bool PrintTiming;
+static bool Server;
 static std::vector<const char *> CommandLine;
 
 #ifndef NDEBUG
@@ -109,6 +112,12 @@ static void ParseArgs(int argc, char **argv) {
 
   if (Args.hasArg(OPT_help)) {
     Tbl.printHelp(llvm::outs(), "clang-scan-deps [options]", "clang-scan-deps");
+    llvm::outs()
+        << "\nWith --server, commands are read from stdin, one per line:\n"
+           "  invalidate <path>  the absolute <path> was modified, added or "
+           "removed\n"
+           "  scan               rescan the affected translation units\n"
+           "  quit               exit\n";
     std::exit(0);
   }
   if (Args.hasArg(OPT_version)) {
@@ -151,6 +160,9 @@ static void ParseArgs(int argc, char **argv) {
   if (const llvm::opt::Arg *A = Args.getLastArg(OPT_module_files_dir_EQ))
     ModuleFilesDir = A->getValue();
 
+  if (const llvm::opt::Arg *A = Args.getLastArg(OPT_directives_cache_EQ))
+    DirectivesCachePath = A->getValue();
+
   OptimizeArgs = Args.hasArg(OPT_optimize_args);
   EagerLoadModules = Args.hasArg(OPT_eager_load_pcm);
 
@@ -198,6 +210,13 @@ static void ParseArgs(int argc, char **argv) {
 
   PrintTiming = Args.hasArg(OPT_print_timing);
 
+  Server = Args.hasArg(OPT_server);
+  if (Server && Format != ScanningOutputFormat::Make) {
+    llvm::errs() << ToolName
+                 << ": the --server option only supports --format=make\n";
+    std::exit(1);
+  }
+
   Verbose = Args.hasArg(OPT_verbose);
 
   RoundTripArgs = Args.hasArg(OPT_round_trip_args);
@@ -765,6 +784,180 @@ getCompilationDataBase(int argc, char **argv, std::string &ErrorMessage) {
       FEOpts.Inputs[0].getFile(), OutputFile, CommandLine);
 }
 
+/// Appends the prerequisites of the make rule in \p Output to \p Deps.
+static void parseMakeDependencies(StringRef Output,
+                                  std::vector<std::string> &Deps) {
+  size_t Colon = Output.find(": ");
+  if (Colon == StringRef::npos)
+    return;
+  std::string Dep;
+  auto Flush = [&]() {
+    if (!Dep.empty())
+      Deps.push_back(std::move(Dep));
+    Dep.clear();
+  };
+  for (size_t I = Colon + 2, E = Output.size(); I != E; ++I) {
+    char C = Output[I];
+    if (C == '\\' && I + 1 != E) {
+      char Next = Output[I + 1];
+      if (Next == '\n') {
+        Flush();
+        ++I;
+        continue;
+      }
+      if (Next == ' ' || Next == '#') {
+        Dep.push_back(Next);
+        ++I;
+        continue;
+      }
+    }
+    if (C == '$' && I + 1 != E && Output[I + 1] == '$') {
+      Dep.push_back('$');
+      ++I;
+      continue;
+    }
+    if (C == ' ' || C == '\t' || C == '\n') {
+      Flush();
+      continue;
+    }
+    Dep.push_back(C);
+  }
+  Flush();
+}
+
+static bool readLine(std::string &Line) {
+  Line.clear();
+  int C;
+  while ((C = std::getchar()) != EOF) {
+    if (C == '\n')
+      return true;
+    Line.push_back(C);
+  }
+  return !Line.empty();
+}
+
+/// Serves rescans of the translation units in \p Inputs until stdin is closed.
+/// The shared cache of \p Service is kept across scans; only the entries of
+/// files reported as invalidated are dropped, and only the translation units
+/// depending on them (or all of them, if an unknown file was reported) are
+/// scanned again.
+///
+/// \returns True on error.
+static bool runServer(DependencyScanningService &Service,
+                      llvm::ThreadPool &Pool,
+                      const std::vector<tooling::CompileCommand> &Inputs) {
+  // Dependencies of each translation unit, as normalized absolute paths.
+  std::vector<llvm::StringSet<>> Deps(Inputs.size());
+  // Normalized paths of all dependencies seen so far.
+  llvm::StringSet<> KnownPaths;
+  std::vector<bool> NeedsScan(Inputs.size(), true);
+  std::vector<std::string> Invalidated;
+  bool HadErrors = false;
+
+  std::string Line;
+  while (readLine(Line)) {
+    StringRef Command = StringRef(Line).trim();
+    if (Command.empty())
+      continue;
+    if (Command == "quit")
+      break;
+
+    if (Command.consume_front("invalidate ")) {
+      SmallString<256> Path(Command.trim());
+      if (!llvm::sys::path::is_absolute(Path)) {
+        llvm::errs() << "error: invalidated path must be absolute: " << Path
+                     << "\n";
+        continue;
+      }
+      llvm::sys::path::remove_dots(Path, /*remove_dot_dot=*/true);
+      Invalidated.push_back(std::string(Path));
+      continue;
+    }
+
+    if (Command != "scan") {
+      llvm::errs() << "error: unknown command: " << Command << "\n";
+      continue;
+    }
+
+    // Invalidate the cached filesystem state and find affected inputs. The
+    // cache drops every spelling of an invalidated path.
+    std::vector<StringRef> StaleFilenames;
+    for (const std::string &Path : Invalidated) {
+      StaleFilenames.push_back(Path);
+      if (!KnownPaths.contains(Path)) {
+        // This may be a new file that shadows an existing one.
+        NeedsScan.assign(Inputs.size(), true);
+        continue;
+      }
+      for (size_t I = 0, E = Inputs.size(); I != E; ++I)
+        if (Deps[I].contains(Path))
+          NeedsScan[I] = true;
+    }
+    Service.getSharedCache().invalidateEntries(StaleFilenames);
+    Invalidated.clear();
+
+    std::vector<size_t> Indices;
+    for (size_t I = 0, E = Inputs.size(); I != E; ++I)
+      if (NeedsScan[I])
+        Indices.push_back(I);
+
+    // Fresh workers don't carry over local caches from the previous scan.
+    std::vector<std::unique_ptr<DependencyScanningTool>> WorkerTools;
+    for (unsigned I = 0; I < Pool.getThreadCount(); ++I)
+      WorkerTools.push_back(std::make_unique<DependencyScanningTool>(Service));
+
+    std::vector<std::optional<llvm::Expected<std::string>>> Results(
+        Indices.size());
+    std::atomic<size_t> NextIndex(0);
+    for (unsigned I = 0; I < Pool.getThreadCount(); ++I) {
+      Pool.async([&, I]() {
+        for (size_t J; (J = NextIndex++) < Indices.size();) {
+          const tooling::CompileCommand &Input = Inputs[Indices[J]];
+          Results[J].emplace(WorkerTools[I]->getDependencyFile(
+              Input.CommandLine, Input.Directory));
+        }
+      });
+    }
+    Pool.wait();
+
+    for (size_t J = 0, E = Indices.size(); J != E; ++J) {
+      size_t Index = Indices[J];
+      const tooling::CompileCommand &Input = Inputs[Index];
+      llvm::Expected<std::string> &MaybeFile = *Results[J];
+      // A failed scan leaves the input to be retried by the next scan.
+      if (!MaybeFile) {
+        llvm::errs() << "Error while scanning dependencies for "
+                     << Input.Filename << ":\n"
+                     << llvm::toString(MaybeFile.takeError());
+        HadErrors = true;
+        continue;
+      }
+
+      std::vector<std::string> InputDeps;
+      parseMakeDependencies(*MaybeFile, InputDeps);
+      Deps[Index].clear();
+      for (const std::string &Dep : InputDeps) {
+        SmallString<256> Path(Dep);
+        llvm::sys::fs::make_absolute(Input.Directory, Path);
+        llvm::sys::path::remove_dots(Path, /*remove_dot_dot=*/true);
+        KnownPaths.insert(Path);
+        Deps[Index].insert(Path);
+      }
+      NeedsScan[Index] = false;
+      llvm::outs() << *MaybeFile;
+    }
+    llvm::outs() << "# clang-scan-deps: scanned " << Indices.size() << " of "
+                 << Inputs.size() << " translation units\n";
+    llvm::outs().flush();
+  }
+
+  if (!DirectivesCachePath.empty())
+    if (llvm::Error E =
+            Service.getSharedCache().writeDirectivesCache(DirectivesCachePath))
+      llvm::errs() << "warning: " << llvm::toString(std::move(E)) << "\n";
+  return HadErrors;
+}
+
 int clang_scan_deps_main(int argc, char **argv, const llvm::ToolContext &) {
   std::string ErrorMessage;
   std::unique_ptr<tooling::CompilationDatabase> Compilations =
@@ -847,7 +1040,14 @@ int clang_scan_deps_main(int argc, char **argv, const llvm::ToolContext &) {
 
   DependencyScanningService Service(ScanMode, Format, OptimizeArgs,
                                     EagerLoadModules);
+  if (!DirectivesCachePath.empty())
+    if (llvm::Error E =
+            Service.getSharedCache().loadDirectivesCache(DirectivesCachePath))
+      llvm::errs() << "warning: " << llvm::toString(std::move(E)) << "\n";
   llvm::ThreadPool Pool(llvm::hardware_concurrency(NumThreads));
+  if (Server)
+    return runServer(Service, Pool,
+                     AdjustingCompilations->getAllCompileCommands());
   std::vector<std::unique_ptr<DependencyScanningTool>> WorkerTools;
   for (unsigned I = 0; I < Pool.getThreadCount(); ++I)
     WorkerTools.push_back(std::make_unique<DependencyScanningTool>(Service));
@@ -978,6 +1178,11 @@ int clang_scan_deps_main(int argc, char **argv, const llvm::ToolContext &) {
     if (FD && FD->roundTripCommands(llvm::errs()))
       HadErrors = true;
 
+  if (!DirectivesCachePath.empty())
+    if (llvm::Error E =
+            Service.getSharedCache().writeDirectivesCache(DirectivesCachePath))
+      llvm::errs() << "warning: " << llvm::toString(std::move(E)) << "\n";
+
   if (Format == ScanningOutputFormat::Full)
     FD->printFullOutput(llvm::outs());
   else if (Format == ScanningOutputFormat::P1689)
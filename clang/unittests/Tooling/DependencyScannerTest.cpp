@@ -18,6 +18,7 @@
 #include "clang/Tooling/Tooling.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/MC/TargetRegistry.h"
+#include "llvm/Support/FileUtilities.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TargetSelect.h"
@@ -301,3 +302,78 @@ TEST(DependencyScanner, ScanDepsWithModuleLookup) {
               InterceptFS->StatPaths.end());
   EXPECT_EQ(InterceptFS->ReadFiles, std::vector<std::string>{"test.m"});
 }
+
+TEST(DependencyScanner, DirectivesCacheRoundTrip) {
+  StringRef Source = "#include \"a.h\"\n#define FOO 1\nint x;\n";
+  SmallVector<dependency_directives_scan::Token, 16> Tokens;
+  SmallVector<dependency_directives_scan::Directive, 4> Directives;
+  ASSERT_FALSE(scanSourceForDependencyDirectives(Source, Tokens, Directives));
+
+  SmallString<128> CachePath;
+  ASSERT_FALSE(
+      llvm::sys::fs::createTemporaryFile("directives", "cache", CachePath));
+  llvm::FileRemover Remover(CachePath);
+
+  {
+    DependencyScanningFilesystemSharedCache Cache;
+    ASSERT_THAT_ERROR(Cache.loadDirectivesCache(CachePath), llvm::Succeeded());
+    Cache.recordDirectives(Source, Tokens, Directives);
+    ASSERT_THAT_ERROR(Cache.writeDirectivesCache(CachePath),
+                      llvm::Succeeded());
+  }
+
+  DependencyScanningFilesystemSharedCache Cache;
+  ASSERT_THAT_ERROR(Cache.loadDirectivesCache(CachePath), llvm::Succeeded());
+
+  SmallVector<dependency_directives_scan::Token, 16> CachedTokens;
+  SmallVector<dependency_directives_scan::Directive, 4> CachedDirectives;
+  EXPECT_FALSE(Cache.lookupDirectives("#define BAR\n", CachedTokens,
+                                      CachedDirectives));
+  ASSERT_TRUE(Cache.lookupDirectives(Source, CachedTokens, CachedDirectives));
+
+  ASSERT_EQ(CachedDirectives.size(), Directives.size());
+  for (unsigned I = 0, E = Directives.size(); I != E; ++I) {
+    EXPECT_EQ(CachedDirectives[I].Kind, Directives[I].Kind);
+    ASSERT_EQ(CachedDirectives[I].Tokens.size(), Directives[I].Tokens.size());
+    for (unsigned J = 0, F = Directives[I].Tokens.size(); J != F; ++J) {
+      const auto &Cached = CachedDirectives[I].Tokens[J];
+      const auto &Scanned = Directives[I].Tokens[J];
+      EXPECT_EQ(Cached.Offset, Scanned.Offset);
+      EXPECT_EQ(Cached.Length, Scanned.Length);
+      EXPECT_EQ(Cached.Kind, Scanned.Kind);
+      EXPECT_EQ(Cached.Flags, Scanned.Flags);
+    }
+  }
+}
+
+TEST(DependencyScanner, InvalidateEntriesNormalizesSpellings) {
+  auto VFS = llvm::makeIntrusiveRefCnt<llvm::vfs::InMemoryFileSystem>();
+  VFS->setCurrentWorkingDirectory("/root");
+  DependencyScanningFilesystemSharedCache Cache;
+
+  // Cache stat failures under non-normalized spellings.
+  {
+    DependencyScanningWorkerFilesystem DepFS(Cache, VFS);
+    EXPECT_FALSE(DepFS.status("/root/dir/../a.h"));
+    EXPECT_FALSE(DepFS.status("/root/./b.h"));
+  }
+
+  VFS->addFile("/root/a.h", 0, llvm::MemoryBuffer::getMemBuffer(""));
+  VFS->addFile("/root/b.h", 0, llvm::MemoryBuffer::getMemBuffer(""));
+
+  // A new worker still sees the cached failures.
+  {
+    DependencyScanningWorkerFilesystem DepFS(Cache, VFS);
+    EXPECT_FALSE(DepFS.status("/root/dir/../a.h"));
+    EXPECT_FALSE(DepFS.status("/root/./b.h"));
+  }
+
+  // Invalidating the normalized paths drops every spelling.
+  StringRef Changed[] = {"/root/a.h", "/root/b.h"};
+  Cache.invalidateEntries(Changed);
+  {
+    DependencyScanningWorkerFilesystem DepFS(Cache, VFS);
+    EXPECT_TRUE(DepFS.status("/root/dir/../a.h"));
+    EXPECT_TRUE(DepFS.status("/root/./b.h"));
+  }
+}
@@ -196,6 +196,10 @@ struct GlobalEnv {
     return Job;
   }
 
+  // Runs in the parent after every finished job, so its cost bounds how many
+  // workers the parent can keep busy. The feature files written by the job
+  // are used to pre-filter the candidates, so that only inputs that may add
+  // coverage pay for the out-of-process CrashResistantMerge below.
   void RunOneMergeJob(FuzzJob *Job) {
     auto Stats = ParseFinalStatsFromLog(Job->LogPath);
     NumRuns += Stats.number_of_executed_units;
@@ -84,12 +84,16 @@ public:
     // class must be valid when zero-initialised, and we wish to sample as
     // infrequently as possible when this is the case, hence we underflow to
     // UINT32_MAX.
-    if (GWP_ASAN_UNLIKELY(getThreadLocals()->NextSampleCounter == 0))
-      getThreadLocals()->NextSampleCounter =
+    // This runs on every allocation, so look up the thread locals only once;
+    // with GWP_ASAN_PLATFORM_TLS_HEADER the lookup may not be foldable by the
+    // compiler.
+    ThreadLocalPackedVariables *Locals = getThreadLocals();
+    if (GWP_ASAN_UNLIKELY(Locals->NextSampleCounter == 0))
+      Locals->NextSampleCounter =
           ((getRandomUnsigned32() % (AdjustedSampleRatePlusOne - 1)) + 1) &
           ThreadLocalPackedVariables::NextSampleCounterMask;
 
-    return GWP_ASAN_UNLIKELY(--getThreadLocals()->NextSampleCounter == 0);
+    return GWP_ASAN_UNLIKELY(--Locals->NextSampleCounter == 0);
   }
 
   // Returns whether the provided pointer is a current sampled allocation that
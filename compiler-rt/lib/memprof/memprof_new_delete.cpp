@@ -30,6 +30,12 @@ struct nothrow_t {};
 enum class align_val_t : size_t {};
 } // namespace std
 
+// Allocation hint passed to the operator new overloads that the compiler
+// emits with -optimize-hot-cold-new. Allocators such as tcmalloc use it to
+// segregate hot and cold objects; here it is accepted and ignored so that
+// hinted binaries can still be profiled.
+enum class __hot_cold_t : unsigned char {};
+
 #define OPERATOR_NEW_BODY(type, nothrow)                                       \
   GET_STACK_TRACE_MALLOC;                                                      \
   void *res = memprof_memalign(0, size, &stack, type);                         \
@@ -78,6 +84,41 @@ void *operator new[](size_t size, std::align_val_t align,
   OPERATOR_NEW_BODY_ALIGN(FROM_NEW_BR, true /*nothrow*/);
 }
 
+CXX_OPERATOR_ATTRIBUTE
+void *operator new(size_t size, __hot_cold_t) {
+  OPERATOR_NEW_BODY(FROM_NEW, false /*nothrow*/);
+}
+CXX_OPERATOR_ATTRIBUTE
+void *operator new[](size_t size, __hot_cold_t) {
+  OPERATOR_NEW_BODY(FROM_NEW_BR, false /*nothrow*/);
+}
+CXX_OPERATOR_ATTRIBUTE
+void *operator new(size_t size, std::nothrow_t const &, __hot_cold_t) {
+  OPERATOR_NEW_BODY(FROM_NEW, true /*nothrow*/);
+}
+CXX_OPERATOR_ATTRIBUTE
+void *operator new[](size_t size, std::nothrow_t const &, __hot_cold_t) {
+  OPERATOR_NEW_BODY(FROM_NEW_BR, true /*nothrow*/);
+}
+CXX_OPERATOR_ATTRIBUTE
+void *operator new(size_t size, std::align_val_t align, __hot_cold_t) {
+  OPERATOR_NEW_BODY_ALIGN(FROM_NEW, false /*nothrow*/);
+}
+CXX_OPERATOR_ATTRIBUTE
+void *operator new[](size_t size, std::align_val_t align, __hot_cold_t) {
+  OPERATOR_NEW_BODY_ALIGN(FROM_NEW_BR, false /*nothrow*/);
+}
+CXX_OPERATOR_ATTRIBUTE
+void *operator new(size_t size, std::align_val_t align,
+                   std::nothrow_t const &, __hot_cold_t) {
+  OPERATOR_NEW_BODY_ALIGN(FROM_NEW, true /*nothrow*/);
+}
+CXX_OPERATOR_ATTRIBUTE
+void *operator new[](size_t size, std::align_val_t align,
+                     std::nothrow_t const &, __hot_cold_t) {
+  OPERATOR_NEW_BODY_ALIGN(FROM_NEW_BR, true /*nothrow*/);
+}
+
 #define OPERATOR_DELETE_BODY(type)                                             \
   GET_STACK_TRACE_FREE;                                                        \
   memprof_delete(ptr, 0, 0, &stack, type);
@@ -118,6 +118,11 @@ class Symbolizer final {
   static void LateInitialize();
   // Returns a list of symbolized frames for a given address (containing
   // all inlined functions, if necessary).
+  // Results are not cached: every call queries the symbolizer tools again. An
+  // external llvm-symbolizer keeps the debug info it has parsed between
+  // queries, so the per-frame cost is mostly the pipe round trip. Runs that
+  // produce many reports can use symbolize=0 and symbolize the printed
+  // module+offset frames offline.
   SymbolizedStack *SymbolizePC(uptr address);
   bool SymbolizeData(uptr address, DataInfo *info);
   bool SymbolizeFrame(uptr address, FrameInfo *info);
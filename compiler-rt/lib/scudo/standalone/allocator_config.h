@@ -80,6 +80,12 @@ namespace scudo {
 //     // primary64.
 //     static const uptr MapSizeIncrement = 1UL << 18;
 //
+//     // To favor transparent huge pages, a custom config can set GroupSizeLog
+//     // and log2(MapSizeIncrement) to 21 (2MB), and EnableRandomOffset to
+//     // false so that regions are mapped in 2MB aligned chunks. Releasing
+//     // still works on base pages and can split huge pages, so such configs
+//     // usually also want a long release interval.
+//
 //     // Defines the minimal & maximal release interval that can be set.
 //     static const s32 MinReleaseToOsIntervalMs = INT32_MIN;
 //     static const s32 MaxReleaseToOsIntervalMs = INT32_MAX;
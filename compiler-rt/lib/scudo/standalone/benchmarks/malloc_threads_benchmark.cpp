@@ -0,0 +1,54 @@
+//===-- malloc_threads_benchmark.cpp ----------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Multi-threaded malloc/free throughput, to compare the exclusive and shared
+// TSD registries as the number of threads grows past the number of TSDs.
+
+#include "allocator_config.h"
+#include "combined.h"
+#include "common.h"
+
+#include "benchmark/benchmark.h"
+
+// The allocators are shared by all the threads of a benchmark run and are
+// never torn down, as the TSDs of exited threads may still refer to them. Like
+// the allocator behind the C wrappers, they initialize themselves on first use.
+template <typename Config> static scudo::Allocator<Config> *getAllocator() {
+  static scudo::Allocator<Config> Allocator;
+  return &Allocator;
+}
+
+template <typename Config>
+static void BM_malloc_free_threaded(benchmark::State &State) {
+  scudo::Allocator<Config> *Allocator = getAllocator<Config>();
+  const size_t NBytes = static_cast<size_t>(State.range(0));
+  const size_t PageSize = scudo::getPageSizeCached();
+
+  for (auto _ : State) {
+    void *Ptr = Allocator->allocate(NBytes, scudo::Chunk::Origin::Malloc);
+    auto *Data = reinterpret_cast<uint8_t *>(Ptr);
+    for (size_t I = 0; I < NBytes; I += PageSize)
+      Data[I] = 1;
+    benchmark::DoNotOptimize(Ptr);
+    Allocator->deallocate(Ptr, scudo::Chunk::Origin::Malloc);
+  }
+
+  State.SetBytesProcessed(uint64_t(State.iterations()) * uint64_t(NBytes));
+}
+
+static const size_t MinThreadedSize = 8;
+static const size_t MaxThreadedSize = 1 << 12;
+
+#ifndef SCUDO_USE_CUSTOM_CONFIG
+BENCHMARK_TEMPLATE(BM_malloc_free_threaded, scudo::DefaultConfig)
+    ->Range(MinThreadedSize, MaxThreadedSize)
+    ->ThreadRange(1, 64);
+#endif
+BENCHMARK_TEMPLATE(BM_malloc_free_threaded, scudo::AndroidConfig)
+    ->Range(MinThreadedSize, MaxThreadedSize)
+    ->ThreadRange(1, 64);
@@ -0,0 +1,80 @@
+// Mini-benchmark for tsan with many more threads than thread slots.
+// Idea:
+// 1) Spawn N threads (N > kThreadSlotCount, 256 by default), each of which
+//    runs R rounds.
+// 2) In every round a thread works on its own memory, and every
+//    sync_period-th round it also locks one of a few shared mutexes.
+//    Threads that never lock skip the mutexes completely.
+// 3) Threads are started in waves. Within a wave more threads are alive
+//    than there are slots, and every later wave reuses the slots released
+//    by the previous one.
+//
+// This stresses slot preemption/reuse and the cost of acquiring large vector
+// clocks when most threads rarely synchronize.
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+const int kNumMutexes = 16;
+const int kLocalSize = 1024;
+pthread_mutex_t mutexes[kNumMutexes];
+long shared[kNumMutexes];
+
+int n_rounds, sync_period;
+
+void *Thread(void *arg) {
+  long idx = (long)arg;
+  int local[kLocalSize] = {};
+  for (int r = 0; r < n_rounds; r++) {
+    for (int i = 0; i < kLocalSize; i++)
+      local[i] += i + r;
+    if (sync_period && r % sync_period == 0) {
+      int m = (idx + r) % kNumMutexes;
+      pthread_mutex_lock(&mutexes[m]);
+      shared[m] += local[r % kLocalSize];
+      pthread_mutex_unlock(&mutexes[m]);
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  int n_threads, n_waves;
+  if (argc == 1) {
+    n_threads = 512;
+    n_waves = 4;
+    n_rounds = 1000;
+    sync_period = 10;
+  } else if (argc == 5) {
+    n_threads = atoi(argv[1]);
+    n_waves = atoi(argv[2]);
+    n_rounds = atoi(argv[3]);
+    sync_period = atoi(argv[4]);
+    assert(n_threads > 0 && n_waves > 0 && n_rounds > 0 && sync_period >= 0);
+  } else {
+    printf("Usage: %s n_threads n_waves n_rounds sync_period\n", argv[0]);
+    return 1;
+  }
+  printf("%s: n_threads=%d n_waves=%d n_rounds=%d sync_period=%d\n", __FILE__,
+         n_threads, n_waves, n_rounds, sync_period);
+
+  for (int i = 0; i < kNumMutexes; i++)
+    pthread_mutex_init(&mutexes[i], 0);
+
+  pthread_t *t = new pthread_t[n_threads];
+  for (int w = 0; w < n_waves; w++) {
+    for (int i = 0; i < n_threads; i++) {
+      int status = pthread_create(&t[i], 0, Thread, (void *)(long)i);
+      assert(status == 0);
+    }
+    for (int i = 0; i < n_threads; i++)
+      pthread_join(t[i], 0);
+  }
+  delete[] t;
+
+  for (int i = 0; i < kNumMutexes; i++)
+    pthread_mutex_destroy(&mutexes[i]);
+  return 0;
+}
@@ -28,6 +28,11 @@ namespace __xray {
 /// get from or return buffers to the queue. This is one key component of the
 /// "flight data recorder" (FDR) mode to support ongoing XRay function call
 /// trace collection.
+///
+/// The queue's spin mutex is only taken when a thread starts tracing or its
+/// current buffer fills up; records are appended to the thread's own buffer
+/// without any synchronisation. Larger buffers (the `buffer_size` FDR flag)
+/// therefore directly reduce how often threads meet on the lock.
 class BufferQueue {
 public:
   /// ControlBlock represents the memory layout of how we interpret the backing
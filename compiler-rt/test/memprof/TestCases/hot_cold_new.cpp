@@ -0,0 +1,26 @@
+// Check that the hinted operator new overloads emitted for
+// -optimize-hot-cold-new are provided by the runtime and profiled like the
+// unhinted ones.
+
+// RUN: %clangxx_memprof -O0 %s -o %t
+// RUN: %env_memprof_opts=print_text=true:log_path=stderr %run %t 2>&1 | FileCheck %s
+
+// CHECK:  Memory allocation stack id = [[STACKID:[0-9]+]]{{[[:space:]].*}}alloc_count 1, size (ave/min/max) 40.00 / 40 / 40
+// CHECK: Stack for id [[STACKID]]:
+// CHECK-NEXT: #0 {{.*}} in operator new
+// CHECK-NEXT: #1 {{.*}} in main {{.*}}:[[@LINE+8]]
+
+#include <stddef.h>
+
+enum class __hot_cold_t : unsigned char {};
+void *operator new[](size_t, __hot_cold_t);
+
+int main() {
+  int *p = (int *)operator new[](10 * sizeof(int), (__hot_cold_t)0);
+  for (int i = 0; i < 10; i++)
+    p[i] = i;
+  int j = 0;
+  for (int i = 0; i < 10; i++)
+    j += p[i];
+  return 0;
+}
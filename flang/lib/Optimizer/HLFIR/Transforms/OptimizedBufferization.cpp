@@ -577,7 +577,8 @@ mlir::LogicalResult BroadcastAssignBufferization::matchAndRewrite(
 ///     }
 ///   }
 ///
-/// The transformation is correct only when LHS and RHS do not alias.
+/// The transformation is correct only when LHS and RHS do not alias, or
+/// when they are identical or disjoint sections of the same array.
 /// This transformation does not support runtime checking for
 /// non-conforming LHS/RHS arrays' shapes currently.
 class VariableAssignBufferization
@@ -628,9 +629,10 @@ mlir::LogicalResult VariableAssignBufferization::matchAndRewrite(
 
   fir::AliasAnalysis aliasAnalysis;
   mlir::AliasResult aliasRes = aliasAnalysis.alias(lhs, rhs);
-  // TODO: use areIdenticalOrDisjointSlices() to check if
-  // we can still do the expansion.
-  if (!aliasRes.isNo()) {
+  // An element-by-element copy is still correct when the two sides are
+  // identical or completely disjoint sections of the same array, e.g.
+  // A(:,1:N,I) = A(:,1:N,J) or X(1:K) = X(K+1:2*K).
+  if (!aliasRes.isNo() && !areIdenticalOrDisjointSlices(lhs, rhs)) {
     LLVM_DEBUG(llvm::dbgs() << "VariableAssignBufferization:\n"
                             << "\tLHS: " << lhs << "\n"
                             << "\tRHS: " << rhs << "\n"
@@ -15,6 +15,7 @@
 #include "environment.h"
 #include "tools.h"
 #include "utf.h"
+#include <cstring>
 
 namespace Fortran::runtime::io {
 
@@ -92,11 +93,17 @@ bool EmitRepeated(CONTEXT &to, char ch, std::size_t n) {
   ConnectionState &connection{to.GetConnectionState()};
   if (connection.internalIoCharKind <= 1 &&
       connection.access != Access::Stream) {
-    // faster path, no encoding needed
-    while (n-- > 0) {
-      if (!to.Emit(&ch, 1)) {
+    // faster path, no encoding needed; emit in chunks rather than one
+    // character at a time, since each Emit() goes through the statement
+    // and unit dispatch and record length checks
+    char buffer[64];
+    std::memset(buffer, ch, n < sizeof buffer ? n : sizeof buffer);
+    while (n > 0) {
+      std::size_t chunk{n < sizeof buffer ? n : sizeof buffer};
+      if (!to.Emit(buffer, chunk)) {
         return false;
       }
+      n -= chunk;
     }
   } else {
     while (n-- > 0) {
@@ -65,10 +65,15 @@ private:
 //   DO 1 I = 1, NROWS
 //    DO 1 J = 1, NCOLS
 //   1 RES(I,J) = 0
-//   DO 2 K = 1, N
-//    DO 2 J = 1, NCOLS
+//   DO 2 J = 1, NCOLS
+//    DO 2 K = 1, N
 //     DO 2 I = 1, NROWS
 //   2  RES(I,J) = RES(I,J) + X(I,K)*Y(K,J) ! loop-invariant last term
+// Each column of the result stays in cache while it is being computed,
+// rather than the whole result being swept once per K, and four columns
+// of X are accumulated into it per sweep so that RES(I,J) is loaded and
+// stored once for every four products.  The order of the additions into
+// each RES(I,J) is unchanged.
 template <TypeCategory RCAT, int RKIND, typename XT, typename YT,
     bool X_HAS_STRIDED_COLUMNS, bool Y_HAS_STRIDED_COLUMNS>
 inline void MatrixTimesMatrix(CppTypeFor<RCAT, RKIND> *RESTRICT product,
@@ -77,27 +82,43 @@ inline void MatrixTimesMatrix(CppTypeFor<RCAT, RKIND> *RESTRICT product,
     std::size_t yColumnByteStride = 0) {
   using ResultType = CppTypeFor<RCAT, RKIND>;
   std::memset(product, 0, rows * cols * sizeof *product);
-  const XT *RESTRICT xp0{x};
-  for (SubscriptValue k{0}; k < n; ++k) {
-    ResultType *RESTRICT p{product};
-    for (SubscriptValue j{0}; j < cols; ++j) {
-      const XT *RESTRICT xp{xp0};
-      ResultType yv;
-      if constexpr (!Y_HAS_STRIDED_COLUMNS) {
-        yv = static_cast<ResultType>(y[k + j * n]);
-      } else {
-        yv = static_cast<ResultType>(reinterpret_cast<const YT *>(
-            reinterpret_cast<const char *>(y) + j * yColumnByteStride)[k]);
-      }
+  std::size_t xStride{X_HAS_STRIDED_COLUMNS ? xColumnByteStride
+                                            : rows * sizeof(XT)};
+  std::size_t yStride{Y_HAS_STRIDED_COLUMNS ? yColumnByteStride
+                                            : n * sizeof(YT)};
+  auto xColumn{[=](SubscriptValue k) {
+    return reinterpret_cast<const XT *>(
+        reinterpret_cast<const char *>(x) + k * xStride);
+  }};
+  for (SubscriptValue j{0}; j < cols; ++j) {
+    ResultType *RESTRICT p{product + j * rows};
+    const YT *RESTRICT yp{reinterpret_cast<const YT *>(
+        reinterpret_cast<const char *>(y) + j * yStride)};
+    SubscriptValue k{0};
+    for (; k + 4 <= n; k += 4) {
+      const XT *RESTRICT xp0{xColumn(k)};
+      const XT *RESTRICT xp1{xColumn(k + 1)};
+      const XT *RESTRICT xp2{xColumn(k + 2)};
+      const XT *RESTRICT xp3{xColumn(k + 3)};
+      auto yv0{static_cast<ResultType>(yp[k])};
+      auto yv1{static_cast<ResultType>(yp[k + 1])};
+      auto yv2{static_cast<ResultType>(yp[k + 2])};
+      auto yv3{static_cast<ResultType>(yp[k + 3])};
       for (SubscriptValue i{0}; i < rows; ++i) {
-        *p++ += static_cast<ResultType>(*xp++) * yv;
+        ResultType sum{p[i]};
+        sum += static_cast<ResultType>(xp0[i]) * yv0;
+        sum += static_cast<ResultType>(xp1[i]) * yv1;
+        sum += static_cast<ResultType>(xp2[i]) * yv2;
+        sum += static_cast<ResultType>(xp3[i]) * yv3;
+        p[i] = sum;
       }
     }
-    if constexpr (!X_HAS_STRIDED_COLUMNS) {
-      xp0 += rows;
-    } else {
-      xp0 = reinterpret_cast<const XT *>(
-          reinterpret_cast<const char *>(xp0) + xColumnByteStride);
+    for (; k < n; ++k) {
+      const XT *RESTRICT xp{xColumn(k)};
+      auto yv{static_cast<ResultType>(yp[k])};
+      for (SubscriptValue i{0}; i < rows; ++i) {
+        p[i] += static_cast<ResultType>(xp[i]) * yv;
+      }
     }
   }
 }
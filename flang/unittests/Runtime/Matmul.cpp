@@ -198,3 +198,85 @@ TEST(Matmul, Basic) {
   EXPECT_TRUE(
       static_cast<bool>(*result.ZeroBasedIndexedElement<std::uint16_t>(3)));
 }
+
+TEST(Matmul, LongInnerDimension) {
+  // X(3,6) * Y(6,2): the inner dimension is long enough to run both the
+  // unrolled loop over K and its remainder, with contiguous operands and with
+  // column sections whose columns are not adjacent in memory.
+  static constexpr int rows{3}, n{6}, cols{2};
+  std::vector<std::int32_t> xData, x2Data;
+  for (int k{0}; k < n; ++k) {
+    for (int i{0}; i < rows; ++i) {
+      xData.push_back(i + 2 * k + 1);
+      x2Data.push_back(i + 2 * k + 1);
+    }
+    x2Data.push_back(-1);
+  }
+  std::vector<std::int32_t> yData, y2Data;
+  for (int j{0}; j < cols; ++j) {
+    y2Data.push_back(-1);
+    for (int k{0}; k < n; ++k) {
+      yData.push_back(k - 3 * j);
+      y2Data.push_back(k - 3 * j);
+    }
+  }
+  std::vector<std::int32_t> expected;
+  for (int j{0}; j < cols; ++j) {
+    for (int i{0}; i < rows; ++i) {
+      std::int32_t sum{0};
+      for (int k{0}; k < n; ++k) {
+        sum += xData[i + k * rows] * yData[k + j * n];
+      }
+      expected.push_back(sum);
+    }
+  }
+
+  auto x{MakeArray<TypeCategory::Integer, 4>(
+      std::vector<int>{rows, n}, xData)};
+  auto y{MakeArray<TypeCategory::Integer, 4>(
+      std::vector<int>{n, cols}, yData)};
+  // X2 and Y2 hold X and Y with an extra row of -1 after respectively before
+  // each column.
+  auto x2{MakeArray<TypeCategory::Integer, 4>(
+      std::vector<int>{rows + 1, n}, x2Data)};
+  auto y2{MakeArray<TypeCategory::Integer, 4>(
+      std::vector<int>{n + 1, cols}, y2Data)};
+
+  static constexpr int sectionRank{2};
+  StaticDescriptor<sectionRank> sectionStaticDescriptorX2;
+  Descriptor &sectionX2{sectionStaticDescriptorX2.descriptor()};
+  sectionX2.Establish(x2->type(), x2->ElementBytes(),
+      /*p=*/nullptr, /*rank=*/sectionRank);
+  static const SubscriptValue lowersX2[]{1, 1}, uppersX2[]{rows, n};
+  const auto errorX2{CFI_section(
+      &sectionX2.raw(), &x2->raw(), lowersX2, uppersX2, /*strides=*/nullptr)};
+  ASSERT_EQ(errorX2, 0) << "CFI_section failed for X2: " << errorX2;
+
+  StaticDescriptor<sectionRank> sectionStaticDescriptorY2;
+  Descriptor &sectionY2{sectionStaticDescriptorY2.descriptor()};
+  sectionY2.Establish(y2->type(), y2->ElementBytes(),
+      /*p=*/nullptr, /*rank=*/sectionRank);
+  static const SubscriptValue lowersY2[]{2, 1};
+  const auto errorY2{CFI_section(&sectionY2.raw(), &y2->raw(), lowersY2,
+      /*uppers=*/nullptr, /*strides=*/nullptr)};
+  ASSERT_EQ(errorY2, 0) << "CFI_section failed for Y2: " << errorY2;
+
+  auto check{[&](const Descriptor &xArg, const Descriptor &yArg) {
+    StaticDescriptor<2, true> statDesc;
+    Descriptor &result{statDesc.descriptor()};
+    RTNAME(Matmul)(result, xArg, yArg, __FILE__, __LINE__);
+    ASSERT_EQ(result.rank(), 2);
+    EXPECT_EQ(result.GetDimension(0).Extent(), rows);
+    EXPECT_EQ(result.GetDimension(1).Extent(), cols);
+    ASSERT_EQ(result.type(), (TypeCode{TypeCategory::Integer, 4}));
+    for (int j{0}; j < rows * cols; ++j) {
+      EXPECT_EQ(*result.ZeroBasedIndexedElement<std::int32_t>(j), expected[j])
+          << "element " << j;
+    }
+    result.Destroy();
+  }};
+  check(*x, *y);
+  check(sectionX2, *y);
+  check(*x, sectionY2);
+  check(sectionX2, sectionY2);
+}
@@ -878,6 +878,32 @@ LIBC_INLINE bool is_float_hex_start(const char *__restrict src,
   return isalnum(src[first_digit]) && b36_char_to_int(src[first_digit]) < 16;
 }
 
+// Checks if the next 8 characters of the string pointer are all decimal
+// digits. Stops at the first character that isn't, so it never reads past the
+// end of the string.
+LIBC_INLINE bool is_eight_digits(const char *__restrict src) {
+  for (size_t i = 0; i < 8; ++i)
+    if (!isdigit(src[i]))
+      return false;
+  return true;
+}
+
+// Converts 8 decimal digits to their value with a few multiplications on the
+// packed characters instead of one multiply-add per digit.
+LIBC_INLINE uint32_t parse_eight_digits(const char *__restrict src) {
+  uint64_t val = 0;
+  for (size_t i = 0; i < 8; ++i)
+    val |= static_cast<uint64_t>(static_cast<uint8_t>(src[i])) << (8 * i);
+  val -= 0x3030303030303030;
+  // Combine adjacent digits into 2 digit numbers in every other byte.
+  val = (val * 10) + (val >> 8);
+  // Combine those into 4 digit numbers and then into the final value.
+  val = (((val & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+         (((val >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+        32;
+  return static_cast<uint32_t>(val);
+}
+
 // Takes the start of a string representing a decimal float, as well as the
 // local decimalPoint. It returns if it suceeded in parsing any digits, and if
 // the return value is true then the outputs are pointer to the end of the
@@ -908,10 +934,24 @@ decimal_string_to_float(const char *__restrict src, const char DECIMAL_POINT,
   // The loop fills the mantissa with as many digits as it can hold
   const BitsType bitstype_max_div_by_base =
       cpp::numeric_limits<BitsType>::max() / BASE;
+  // Below this bound, 8 more digits can be added to the mantissa the same way
+  // the loop below would add them one by one.
+  const BitsType bitstype_max_div_by_base_pow8 =
+      cpp::numeric_limits<BitsType>::max() / BitsType(100000000);
   while (true) {
     if (isdigit(src[index])) {
-      uint32_t digit = src[index] - '0';
       seen_digit = true;
+      if (mantissa < bitstype_max_div_by_base_pow8 &&
+          is_eight_digits(src + index)) {
+        mantissa = (mantissa * BitsType(100000000)) +
+                   BitsType(parse_eight_digits(src + index));
+        if (after_decimal)
+          exponent -= 8;
+        index += 8;
+        continue;
+      }
+
+      uint32_t digit = src[index] - '0';
 
       if (mantissa < bitstype_max_div_by_base) {
         mantissa = (mantissa * BASE) + digit;
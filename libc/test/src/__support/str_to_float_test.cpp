@@ -132,6 +132,20 @@ TEST(LlvmLibcStrToFloatTest, LeadingZeroes) {
   EXPECT_EQ(LIBC_NAMESPACE::internal::leading_zeroes<uint32_t>(0xffffffff), 0u);
 }
 
+TEST(LlvmLibcStrToFloatTest, ParseEightDigits) {
+  EXPECT_TRUE(LIBC_NAMESPACE::internal::is_eight_digits("12345678"));
+  EXPECT_TRUE(LIBC_NAMESPACE::internal::is_eight_digits("000000009"));
+  EXPECT_FALSE(LIBC_NAMESPACE::internal::is_eight_digits("1234567"));
+  EXPECT_FALSE(LIBC_NAMESPACE::internal::is_eight_digits("1234.5678"));
+
+  EXPECT_EQ(LIBC_NAMESPACE::internal::parse_eight_digits("00000000"), 0u);
+  EXPECT_EQ(LIBC_NAMESPACE::internal::parse_eight_digits("12345678"),
+            12345678u);
+  EXPECT_EQ(LIBC_NAMESPACE::internal::parse_eight_digits("00000901"), 901u);
+  EXPECT_EQ(LIBC_NAMESPACE::internal::parse_eight_digits("99999999"),
+            99999999u);
+}
+
 TEST_F(LlvmLibcStrToFloatTest, ClingerFastPathFloat64Simple) {
   clinger_fast_path_test<double>(123, 0, 0xEC00000000000, 1029);
   clinger_fast_path_test<double>(1234567890123456, 1, 0x5ee2a2eb5a5c0, 1076);
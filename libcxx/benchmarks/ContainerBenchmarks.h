@@ -163,6 +163,23 @@ static void BM_Find(benchmark::State& st, Container c, GenInputs gen) {
   }
 }
 
+// Looks up keys that are not in the container. For node-based hash tables this
+// walks the whole bucket chain, so it is sensitive to the load factor and to the
+// cache locality of the nodes.
+template <class Container, class GenInputs>
+static void BM_FindMissing(benchmark::State& st, Container c, GenInputs gen) {
+  auto in        = gen(2 * st.range(0));
+  const auto mid = in.begin() + st.range(0);
+  c.insert(in.begin(), mid);
+  const auto end = in.data() + in.size();
+  while (st.KeepRunning()) {
+    for (auto it = in.data() + st.range(0); it != end; ++it) {
+      benchmark::DoNotOptimize(c.find(*it) == c.end());
+    }
+    benchmark::ClobberMemory();
+  }
+}
+
 template <class Container, class GenInputs>
 static void BM_FindRehash(benchmark::State& st, Container c, GenInputs gen) {
   c.rehash(8);
@@ -27,6 +27,21 @@ static void BM_format_string(benchmark::State& state) {
 BENCHMARK_TEMPLATE(BM_format_string, char)->RangeMultiplier(2)->Range(1, 1 << 20);
 BENCHMARK_TEMPLATE(BM_format_string, wchar_t)->RangeMultiplier(2)->Range(1, 1 << 20);
 
+// Most of the output comes from the literal text of the format string.
+static void BM_format_literal_text(benchmark::State& state) {
+  size_t size = state.range(0);
+  std::string fmt(size, '*');
+  fmt += "{}";
+  fmt.append(size, '*');
+  int value = 42;
+
+  while (state.KeepRunningBatch(fmt.size()))
+    benchmark::DoNotOptimize(std::vformat(fmt, std::make_format_args(value)));
+
+  state.SetBytesProcessed(state.iterations() * fmt.size());
+}
+BENCHMARK(BM_format_literal_text)->RangeMultiplier(2)->Range(1, 1 << 20);
+
 int main(int argc, char** argv) {
   benchmark::Initialize(&argc, argv);
   if (benchmark::ReportUnrecognizedArguments(argc, argv))
@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Allocates and frees batches of small blocks. Resources that are shared by all
+// the threads of a benchmark show how they scale with contention.
+static void bm_allocate_deallocate(benchmark::State& state, std::pmr::memory_resource* resource) {
+  const std::size_t size = state.range(0);
+  std::vector<void*> blocks(64);
+  for (auto _ : state) {
+    for (void*& block : blocks)
+      block = resource->allocate(size);
+    benchmark::DoNotOptimize(blocks.data());
+    for (void* block : blocks)
+      resource->deallocate(block, size);
+  }
+  state.SetItemsProcessed(state.iterations() * blocks.size());
+}
+
+static void bm_synchronized_pool(benchmark::State& state) {
+  static std::pmr::synchronized_pool_resource resource;
+  bm_allocate_deallocate(state, &resource);
+}
+BENCHMARK(bm_synchronized_pool)->Arg(16)->Arg(256)->ThreadRange(1, 16)->UseRealTime();
+
+static void bm_new_delete(benchmark::State& state) { bm_allocate_deallocate(state, std::pmr::new_delete_resource()); }
+BENCHMARK(bm_new_delete)->Arg(16)->Arg(256)->ThreadRange(1, 16)->UseRealTime();
+
+// Gives every thread its own unsynchronized pool, which is the upper bound for
+// a synchronized pool with per-thread caches.
+static void bm_unsynchronized_pool_per_thread(benchmark::State& state) {
+  std::pmr::unsynchronized_pool_resource resource;
+  bm_allocate_deallocate(state, &resource);
+}
+BENCHMARK(bm_unsynchronized_pool_per_thread)->Arg(16)->Arg(256)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -204,6 +204,10 @@ BENCHMARK_CAPTURE(BM_FindRehash,
                   getRandomIntegerInputs<uint64_t>)
     ->Arg(TestNumInputs);
 
+BENCHMARK_CAPTURE(
+    BM_FindMissing, unordered_set_random_uint64, std::unordered_set<uint64_t>{}, getRandomIntegerInputs<uint64_t>)
+    ->Arg(TestNumInputs);
+
 // Sorted //
 BENCHMARK_CAPTURE(
     BM_Find, unordered_set_sorted_uint64, std::unordered_set<uint64_t>{}, getSortedIntegerInputs<uint64_t>)
@@ -215,6 +219,10 @@ BENCHMARK_CAPTURE(BM_FindRehash,
                   getSortedIntegerInputs<uint64_t>)
     ->Arg(TestNumInputs);
 
+BENCHMARK_CAPTURE(
+    BM_FindMissing, unordered_set_sorted_uint64, std::unordered_set<uint64_t>{}, getSortedIntegerInputs<uint64_t>)
+    ->Arg(TestNumInputs);
+
 // Sorted //
 BENCHMARK_CAPTURE(BM_Find,
                   unordered_set_sorted_uint128,
@@ -268,6 +276,9 @@ BENCHMARK_CAPTURE(BM_Find, unordered_set_string, std::unordered_set<std::string>
 BENCHMARK_CAPTURE(BM_FindRehash, unordered_set_string, std::unordered_set<std::string>{}, getRandomStringInputs)
     ->Arg(TestNumInputs);
 
+BENCHMARK_CAPTURE(BM_FindMissing, unordered_set_string, std::unordered_set<std::string>{}, getRandomStringInputs)
+    ->Arg(TestNumInputs);
+
 // Prefixed String //
 BENCHMARK_CAPTURE(
     BM_Find, unordered_set_prefixed_string, std::unordered_set<std::string>{}, getPrefixedRandomStringInputs)
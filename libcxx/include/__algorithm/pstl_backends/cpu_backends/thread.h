@@ -27,6 +27,10 @@ _LIBCPP_PUSH_MACROS
 
 // This backend implementation is for testing purposes only and not meant for production use. This will be replaced
 // by a proper implementation once the PSTL implementation is somewhat stable.
+//
+// Like the libdispatch backend, a real implementation should keep its thread pool in the dylib (see
+// src/pstl/libdispatch.cpp) and only expose chunking entry points here, so that the scheduler can change without
+// affecting the ABI of user code.
 
 _LIBCPP_BEGIN_NAMESPACE_STD
 
@@ -328,6 +328,20 @@ __vformat_to(_ParseCtx&& __parse_ctx, _Ctx&& __ctx) {
         std::__throw_format_error("The format string contains an invalid escape sequence");
 
       break;
+
+    default:
+      if constexpr (same_as<typename _Ctx::iterator, back_insert_iterator<__output_buffer<_CharT>>>) {
+        // Copy the literal text up to the next replacement field or escape
+        // sequence in one go, instead of one character at a time.
+        auto __last = __begin + 1;
+        while (__last != __end && *__last != _CharT('{') && *__last != _CharT('}'))
+          ++__last;
+
+        __out_it.__get_container()->__copy(basic_string_view<_CharT>{__begin, __last});
+        __begin = __last;
+        continue;
+      }
+      break;
     }
 
     // Copy the character to the output verbatim.
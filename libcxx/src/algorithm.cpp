@@ -8,11 +8,45 @@
 
 #include <algorithm>
 #include <bit>
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 _LIBCPP_BEGIN_NAMESPACE_STD
 
-template <class Comp, class RandomAccessIterator>
-void __sort(RandomAccessIterator first, RandomAccessIterator last, Comp comp) {
+namespace {
+
+template <class T>
+constexpr bool use_radix_sort = (is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)) ||
+                                 ((is_same_v<T, float> || is_same_v<T, double>) && numeric_limits<T>::is_iec559);
+
+// Below this size introsort beats the counting passes.
+constexpr ptrdiff_t radix_sort_threshold = 1 << 14;
+
+// Buckets below this size are sorted with introsort instead of another pass.
+constexpr ptrdiff_t radix_sort_bucket_threshold = 64;
+
+// Maps a value to an unsigned integer that orders the same way under operator<.
+// -0.0 is ordered before +0.0, which is fine since std::sort is not stable.
+template <class T>
+auto to_radix_key(T value) {
+  if constexpr (is_floating_point_v<T>) {
+    using U     = conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    U bits      = std::bit_cast<U>(value);
+    U sign_mask = U(1) << (sizeof(U) * CHAR_BIT - 1);
+    return (bits & sign_mask) ? U(~bits) : U(bits | sign_mask);
+  } else {
+    using U = make_unsigned_t<T>;
+    U bits  = static_cast<U>(value);
+    if constexpr (is_signed_v<T>)
+      bits ^= U(1) << (sizeof(U) * CHAR_BIT - 1);
+    return bits;
+  }
+}
+
+template <class RandomAccessIterator>
+void introsort(RandomAccessIterator first, RandomAccessIterator last) {
   auto depth_limit = 2 * std::__bit_log2(static_cast<size_t>(last - first));
 
   // Only use bitset partitioning for arithmetic types.  We should also check
@@ -25,6 +59,77 @@ void __sort(RandomAccessIterator first, RandomAccessIterator last, Comp comp) {
       first, last, ranges::less{}, depth_limit);
 }
 
+// In-place MSD radix sort on bytes (American flag sort), starting with the byte
+// at `shift`. Like introsort it does not allocate: values are swapped into
+// their buckets within the range. The recursion is at most sizeof(T) deep and
+// uses two 256-entry count arrays per level.
+template <class T>
+void radix_sort(T* first, T* last, int shift) {
+  const size_t n = static_cast<size_t>(last - first);
+  size_t ends[256];
+  for (;;) {
+    std::fill(ends, ends + 256, 0);
+    for (T* it = first; it != last; ++it)
+      ++ends[(to_radix_key(*it) >> shift) & 0xff];
+    // Skip bytes that are the same in all the values, e.g. the high bytes of
+    // small integers.
+    if (ends[(to_radix_key(*first) >> shift) & 0xff] != n)
+      break;
+    if (shift == 0)
+      return;
+    shift -= CHAR_BIT;
+  }
+
+  // Move every value to its bucket by following cycles of displaced values.
+  size_t heads[256];
+  size_t offset = 0;
+  for (size_t digit = 0; digit != 256; ++digit) {
+    heads[digit] = offset;
+    offset += ends[digit];
+    ends[digit] = offset;
+  }
+  for (size_t digit = 0; digit != 256; ++digit) {
+    while (heads[digit] != ends[digit]) {
+      T value            = first[heads[digit]];
+      size_t value_digit = (to_radix_key(value) >> shift) & 0xff;
+      while (value_digit != digit) {
+        std::swap(value, first[heads[value_digit]++]);
+        value_digit = (to_radix_key(value) >> shift) & 0xff;
+      }
+      first[heads[digit]++] = value;
+    }
+  }
+
+  if (shift == 0)
+    return;
+  // Buckets that are small enough are left to introsort.
+  size_t begin = 0;
+  for (size_t digit = 0; digit != 256; ++digit) {
+    size_t end = ends[digit];
+    if (end - begin >= static_cast<size_t>(radix_sort_bucket_threshold))
+      radix_sort(first + begin, first + end, shift - CHAR_BIT);
+    else if (end - begin > 1)
+      introsort(first + begin, first + end);
+    begin = end;
+  }
+}
+
+} // namespace
+
+template <class Comp, class RandomAccessIterator>
+void __sort(RandomAccessIterator first, RandomAccessIterator last, Comp comp) {
+  // These are only instantiated with __less and pointers to arithmetic types,
+  // so large ranges of the types covered above can be sorted by their bytes.
+  using value_type = typename iterator_traits<RandomAccessIterator>::value_type;
+  if constexpr (use_radix_sort<value_type>) {
+    if (last - first >= radix_sort_threshold) {
+      radix_sort(first, last, static_cast<int>(CHAR_BIT * (sizeof(value_type) - 1)));
+      return;
+    }
+  }
+  introsort(first, last);
+}
+
 // clang-format off
 template void __sort<__less<char>&, char*>(char*, char*, __less<char>&);
 #ifndef _LIBCPP_HAS_NO_WIDE_CHARACTERS
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -58,6 +59,29 @@ TEST_CONSTEXPR bool test_constexpr() {
     }
 #endif
 
+// Exercise ranges that span several of the blocks compared by the
+// vectorizable implementation, with the mismatch at every position.
+template <class T>
+void test_long_ranges() {
+    for (int size = 0; size != 300; ++size) {
+        for (int pos = 0; pos <= size; ++pos) {
+            std::vector<T> lhs(size, T(1));
+            std::vector<T> rhs(size, T(1));
+            if (pos != size)
+                rhs[pos] = T(2);
+
+            assert(std::mismatch(lhs.begin(), lhs.end(), rhs.begin())
+                    == std::make_pair(lhs.begin() + pos, rhs.begin() + pos));
+#if TEST_STD_VER > 11
+            assert(std::mismatch(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())
+                    == std::make_pair(lhs.begin() + pos, rhs.begin() + pos));
+            assert(std::mismatch(lhs.begin(), lhs.end(), rhs.begin(), rhs.begin() + pos / 2)
+                    == std::make_pair(lhs.begin() + pos / 2, rhs.begin() + pos / 2));
+#endif
+        }
+    }
+}
+
 int main(int, char**)
 {
     int ia[] = {0, 1, 2, 2, 0, 1, 2, 3};
@@ -86,6 +110,11 @@ int main(int, char**)
             == (std::pair<II, II>(II(ia+2), II(ib+2))));
 #endif
 
+    test_long_ranges<char>();
+    test_long_ranges<short>();
+    test_long_ranges<int>();
+    test_long_ranges<long long>();
+
 #if TEST_STD_VER > 17
     static_assert(test_constexpr());
 #endif
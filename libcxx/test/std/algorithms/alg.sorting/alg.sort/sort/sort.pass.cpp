@@ -245,6 +245,43 @@ void test_adversarial_quicksort(int N) {
   assert(std::is_sorted(V.begin(), V.end()));
 }
 
+template <class T>
+bool less_than(T x, T y) { return x < y; }
+
+// The library may sort large ranges of arithmetic types with the default
+// comparator differently, e.g. by their representation. Check those against a
+// sort with a custom comparator, including negative values for signed types.
+template <class T>
+void test_large_arithmetic_sort(int N)
+{
+    std::vector<T> v(N);
+    for (int i = 0; i < N; ++i)
+        v[i] = static_cast<T>(static_cast<long long>(randomness()) - (1 << 30)) / T(3);
+    std::vector<T> expected = v;
+    std::sort(expected.begin(), expected.end(), less_than<T>);
+    std::sort(v.begin(), v.end());
+    assert(v == expected);
+
+    // Values that only differ in their low bytes.
+    for (int i = 0; i < N; ++i)
+        v[i] = static_cast<T>(randomness() % 100);
+    expected = v;
+    std::sort(expected.begin(), expected.end(), less_than<T>);
+    std::sort(v.begin(), v.end());
+    assert(v == expected);
+}
+
+// -0.0 and +0.0 compare equal, so they may end up in either order.
+template <class T>
+void test_large_signed_zero_sort(int N)
+{
+    std::vector<T> v(N);
+    for (int i = 0; i < N; ++i)
+        v[i] = i % 3 == 0 ? T(-0.0) : i % 3 == 1 ? T(0.0) : T(static_cast<int>(randomness() % 5) - 2);
+    std::sort(v.begin(), v.end());
+    assert(std::is_sorted(v.begin(), v.end()));
+}
+
 template <class Container>
 void run_sort_tests()
 {
@@ -280,6 +317,15 @@ int main(int, char**)
     run_sort_tests<std::deque<int> >();
     run_sort_tests<std::vector<std::pair<int, int> > >();
 
+    test_large_arithmetic_sort<int>(1 << 16);
+    test_large_arithmetic_sort<unsigned>(1 << 16);
+    test_large_arithmetic_sort<long long>(1 << 16);
+    test_large_arithmetic_sort<unsigned long long>(1 << 16);
+    test_large_arithmetic_sort<float>(1 << 16);
+    test_large_arithmetic_sort<double>(1 << 16);
+    test_large_signed_zero_sort<float>(1 << 16);
+    test_large_signed_zero_sort<double>(1 << 16);
+
     test_pointer_sort();
     test_adversarial_quicksort(1 << 20);
 
@@ -1077,6 +1077,17 @@ void TypeMerger::mergeTypesWithGHash() {
                     [&](TpiSource *source) { source->loadGHashes(); });
   }
 
+  // Type records of objects without .debug$H are rehashed on every link.
+  // Remapped type indices depend on all the inputs of a link and can't be
+  // reused across links, but the ghashes can be precomputed by the compiler.
+  size_t numRehashed = llvm::count_if(objectSources, [](TpiSource *source) {
+    return source->ownedGHashes && !source->ghashes.empty();
+  });
+  if (numRehashed)
+    log("computed ghashes for " + Twine(numRehashed) + " of " +
+        Twine(objectSources.size()) +
+        " object files; compile with -gcodeview-ghash to precompute them");
+
   llvm::TimeTraceScope timeScope("Merge types (GHASH)");
   ScopedTimer t2(ctx.mergeGHashTimer);
   GHashState ghashState;
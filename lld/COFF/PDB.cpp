@@ -646,6 +646,10 @@ Error PDBLinker::writeAllModuleSymbolRecords(ObjFile *file,
   std::vector<uint8_t> storage;
   SmallVector<uint32_t, 4> scopes;
 
+  // Writing bytes has a very high overhead, so buffer the symbols of all
+  // subsections of the object file and write them at once.
+  uint32_t moduleSymStart = writer.getOffset();
+
   // Visit all live .debug$S sections a second time, and write them to the PDB.
   for (SectionChunk *debugChunk : file->getDebugChunks()) {
     if (!debugChunk->live || debugChunk->getSize() == 0 ||
@@ -664,9 +668,8 @@ Error PDBLinker::writeAllModuleSymbolRecords(ObjFile *file,
       if (ss.kind() != DebugSubsectionKind::Symbols)
         continue;
 
-      uint32_t moduleSymStart = writer.getOffset();
+      size_t subsectionStart = storage.size();
       scopes.clear();
-      storage.clear();
       ArrayRef<uint8_t> symsBuffer;
       BinaryStreamRef sr = ss.getRecordData();
       cantFail(sr.readBytes(0, sr.getLength(), symsBuffer));
@@ -693,19 +696,12 @@ Error PDBLinker::writeAllModuleSymbolRecords(ObjFile *file,
       // already warned about them in the first analysis pass.
       if (ec) {
         consumeError(std::move(ec));
-        storage.clear();
+        storage.resize(subsectionStart);
       }
-
-      // Writing bytes has a very high overhead, so write the entire subsection
-      // at once.
-      // TODO: Consider buffering symbols for the entire object file to reduce
-      // overhead even further.
-      if (Error e = writer.writeBytes(storage))
-        return e;
     }
   }
 
-  return Error::success();
+  return writer.writeBytes(storage);
 }
 
 Error PDBLinker::commitSymbolsForObject(void *ctx, void *obj,
@@ -0,0 +1,56 @@
+//===- LinkStats.cpp ------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "lld/Common/LinkStats.h"
+#include "lld/Common/Version.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/JSON.h"
+
+#if LLVM_ON_UNIX
+#include <sys/resource.h>
+#endif
+
+using namespace lld;
+using namespace llvm;
+
+// Returns the peak resident set size of the process in bytes, or 0 if the host
+// does not report it.
+static uint64_t getPeakRSSBytes() {
+#if LLVM_ON_UNIX
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#ifdef __APPLE__
+  // Darwin reports ru_maxrss in bytes, other systems in kilobytes.
+  return usage.ru_maxrss;
+#else
+  return uint64_t(usage.ru_maxrss) * 1024;
+#endif
+#else
+  return 0;
+#endif
+}
+
+void LinkStats::write(raw_ostream &os) const {
+  json::OStream j(os, 2);
+  j.object([&] {
+    j.attribute("version", version);
+    j.attribute("linker", getLLDVersion());
+    j.attribute("inputFiles", inputFiles);
+    j.attribute("inputBytes", inputBytes);
+    j.attribute("inputSections", inputSections);
+    j.attribute("symbols", symbols);
+    j.attribute("relocations", relocations);
+    j.attribute("icfIterations", icfIterations);
+    j.attribute("thunkPasses", thunkPasses);
+    j.attribute("outputSections", outputSections);
+    if (uint64_t peakRSSBytes = getPeakRSSBytes())
+      j.attribute("peakRSSBytes", peakRSSBytes);
+  });
+  os << '\n';
+}
@@ -188,6 +188,54 @@ static void mergeClusters(std::vector<Cluster> &cs, Cluster &into, int intoIdx,
   from.weight = 0;
 }
 
+// Print the symbols defined in the sections of \p order, in that order, to the
+// file specified by --print-symbol-order.
+static void printSymbolOrder(ArrayRef<const InputSectionBase *> order) {
+  std::error_code ec;
+  raw_fd_ostream os(config->printSymbolOrder, ec, sys::fs::OF_None);
+  if (ec) {
+    error("cannot open " + config->printSymbolOrder + ": " + ec.message());
+    return;
+  }
+
+  for (const InputSectionBase *sec : order)
+    // Search all the symbols in the file of the section
+    // and find out a Defined symbol with name that is within the section.
+    for (Symbol *sym : sec->file->getSymbols())
+      if (!sym->isSection()) // Filter out section-type symbols here.
+        if (auto *d = dyn_cast<Defined>(sym))
+          if (sec == d->section)
+            os << sym->getName() << "\n";
+}
+
+// Report the number of cache lines, pages and huge pages spanned by the
+// profiled sections if they are laid out contiguously in the given order. This
+// is an upper bound of the hot code footprint, because sections reordered into
+// different output sections are not adjacent in the output.
+static void logFootprint(ArrayRef<const InputSectionBase *> order) {
+  uint64_t size = 0;
+  for (const InputSectionBase *sec : order)
+    size = alignToPowerOf2(size, sec->addralign) + sec->getSize();
+  log("call graph profile: " + Twine(order.size()) + " sections, " +
+      Twine(size) + " bytes, " + Twine(divideCeil(size, 64)) +
+      " 64-byte cache lines, " + Twine(divideCeil(size, 4096)) +
+      " 4 KiB pages, " + Twine(divideCeil(size, 2 * 1024 * 1024)) +
+      " 2 MiB pages");
+}
+
+// Assign increasing priorities to the sections in \p order.
+static DenseMap<const InputSectionBase *, int>
+createOrderMap(ArrayRef<const InputSectionBase *> order) {
+  DenseMap<const InputSectionBase *, int> orderMap;
+  int curOrder = 1;
+  for (const InputSectionBase *sec : order)
+    orderMap[sec] = curOrder++;
+  if (!config->printSymbolOrder.empty())
+    printSymbolOrder(order);
+  logFootprint(order);
+  return orderMap;
+}
+
 // Group InputSections into clusters using the Call-Chain Clustering heuristic
 // then sort the clusters by density.
 DenseMap<const InputSectionBase *, int> CallGraphSort::run() {
@@ -233,42 +281,16 @@ DenseMap<const InputSectionBase *, int> CallGraphSort::run() {
     return clusters[a].getDensity() > clusters[b].getDensity();
   });
 
-  DenseMap<const InputSectionBase *, int> orderMap;
-  int curOrder = 1;
-  for (int leader : sorted) {
+  std::vector<const InputSectionBase *> order;
+  order.reserve(sections.size());
+  for (int leader : sorted)
     for (int i = leader;;) {
-      orderMap[sections[i]] = curOrder++;
+      order.push_back(sections[i]);
       i = clusters[i].next;
       if (i == leader)
         break;
     }
-  }
-  if (!config->printSymbolOrder.empty()) {
-    std::error_code ec;
-    raw_fd_ostream os(config->printSymbolOrder, ec, sys::fs::OF_None);
-    if (ec) {
-      error("cannot open " + config->printSymbolOrder + ": " + ec.message());
-      return orderMap;
-    }
-
-    // Print the symbols ordered by C3, in the order of increasing curOrder
-    // Instead of sorting all the orderMap, just repeat the loops above.
-    for (int leader : sorted)
-      for (int i = leader;;) {
-        // Search all the symbols in the file of the section
-        // and find out a Defined symbol with name that is within the section.
-        for (Symbol *sym : sections[i]->file->getSymbols())
-          if (!sym->isSection()) // Filter out section-type symbols here.
-            if (auto *d = dyn_cast<Defined>(sym))
-              if (sections[i] == d->section)
-                os << sym->getName() << "\n";
-        i = clusters[i].next;
-        if (i == leader)
-          break;
-      }
-  }
-
-  return orderMap;
+  return createOrderMap(order);
 }
 
 // Sort sections by the profile data using the Cache-Directed Sort algorithm.
@@ -325,12 +347,11 @@ DenseMap<const InputSectionBase *, int> elf::computeCacheDirectedSortOrder() {
       funcSizes, funcCounts, callCounts, callOffsets);
 
   // Create the final order.
-  DenseMap<const InputSectionBase *, int> orderMap;
-  int curOrder = 1;
+  std::vector<const InputSectionBase *> order;
+  order.reserve(sortedSections.size());
   for (uint64_t secIdx : sortedSections)
-    orderMap[sections[secIdx]] = curOrder++;
-
-  return orderMap;
+    order.push_back(sections[secIdx]);
+  return createOrderMap(order);
 }
 
 // Sort sections by the profile data provided by --callgraph-profile-file.
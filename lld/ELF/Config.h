@@ -10,6 +10,7 @@
 #define LLD_ELF_CONFIG_H
 
 #include "lld/Common/ErrorHandler.h"
+#include "lld/Common/LinkStats.h"
 #include "llvm/ADT/CachedHashString.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/MapVector.h"
@@ -177,6 +178,7 @@ struct Config {
   llvm::StringRef optStatsFilename;
   llvm::StringRef progName;
   llvm::StringRef printArchiveStats;
+  llvm::StringRef printLinkStats;
   llvm::StringRef printSymbolOrder;
   llvm::StringRef soName;
   llvm::StringRef sysroot;
@@ -257,6 +259,7 @@ struct Config {
   bool mmapOutputFile;
   bool nmagic;
   bool noDynamicLinker = false;
+  bool noKeepMemory;
   bool noinhibitExec;
   bool nostdlib;
   bool oFormatBinary;
@@ -482,6 +485,8 @@ struct Ctx {
   // True if all native vtable symbols have corresponding type info symbols
   // during LTO.
   bool ltoAllVtablesHaveTypeInfos;
+  // Counters reported by --print-link-stats=.
+  LinkStats stats;
 
   // Each symbol assignment and DEFINED(sym) reference is assigned an increasing
   // order. Each DEFINED(sym) evaluation checks whether the reference happens
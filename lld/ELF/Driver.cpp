@@ -111,6 +111,7 @@ void Ctx::reset() {
   scriptSymOrderCounter = 1;
   scriptSymOrder.clear();
   ltoAllVtablesHaveTypeInfos = false;
+  stats = LinkStats();
 }
 
 llvm::raw_fd_ostream Ctx::openAuxiliaryFile(llvm::StringRef filename,
@@ -596,6 +597,34 @@ static void checkZOptions(opt::InputArgList &args) {
       warn("unknown -z value: " + StringRef(arg->getValue()));
 }
 
+// Write the counters collected during the link to --print-link-stats=.
+static void writeLinkStats() {
+  if (config->printLinkStats.empty())
+    return;
+
+  std::error_code ec;
+  raw_fd_ostream os = ctx.openAuxiliaryFile(config->printLinkStats, ec);
+  if (ec) {
+    error("--print-link-stats=: cannot open " + config->printLinkStats + ": " +
+          ec.message());
+    return;
+  }
+
+  LinkStats &stats = ctx.stats;
+  stats.inputFiles = ctx.objectFiles.size() + ctx.sharedFiles.size() +
+                     ctx.binaryFiles.size() + ctx.bitcodeFiles.size();
+  stats.inputBytes = 0;
+  for (const std::unique_ptr<MemoryBuffer> &mb : ctx.memoryBuffers)
+    stats.inputBytes += mb->getBufferSize();
+  stats.inputSections = ctx.inputSections.size();
+  stats.symbols = symtab.getSymbols().size();
+  stats.relocations = 0;
+  for (const InputSectionBase *sec : ctx.inputSections)
+    stats.relocations += sec->relocs().size();
+  stats.outputSections = outputSections.size();
+  stats.write(os);
+}
+
 constexpr const char *saveTempsValues[] = {
     "resolution", "preopt",     "promote", "internalize",  "import",
     "opt",        "precodegen", "prelink", "combinedindex"};
@@ -680,6 +709,8 @@ void LinkerDriver::linkerMain(ArrayRef<const char *> argsArr) {
       return;
 
     link(args);
+    if (!errorCount())
+      writeLinkStats();
   }
 
   if (config->timeTraceEnabled) {
@@ -1331,6 +1362,7 @@ static void readConfigs(opt::InputArgList &args) {
   config->mmapOutputFile =
       args.hasFlag(OPT_mmap_output_file, OPT_no_mmap_output_file, true);
   config->nmagic = args.hasFlag(OPT_nmagic, OPT_no_nmagic, false);
+  config->noKeepMemory = args.hasArg(OPT_no_keep_memory);
   config->noinhibitExec = args.hasArg(OPT_noinhibit_exec);
   config->nostdlib = args.hasArg(OPT_nostdlib);
   config->oFormatBinary = isOutputFormatBinary(args);
@@ -1362,6 +1394,7 @@ static void readConfigs(opt::InputArgList &args) {
       args.hasFlag(OPT_print_gc_sections, OPT_no_print_gc_sections, false);
   config->printMemoryUsage = args.hasArg(OPT_print_memory_usage);
   config->printArchiveStats = args.getLastArgValue(OPT_print_archive_stats);
+  config->printLinkStats = args.getLastArgValue(OPT_print_link_stats);
   config->printSymbolOrder =
       args.getLastArgValue(OPT_print_symbol_order);
   config->relax = args.hasFlag(OPT_relax, OPT_no_relax, true);
@@ -1629,6 +1662,11 @@ static void readConfigs(opt::InputArgList &args) {
     error("-Ttext-segment is not supported. Use --image-base if you "
           "intend to set the base address");
 
+  // gold's --incremental is deliberately left unrecognized. Relinking in place
+  // would need symbol resolution, layout and relocation state persisted and
+  // revalidated across links, which lld does not keep, and silently doing a
+  // full link would hide that.
+
   // Parse ELF{32,64}{LE,BE} and CPU type.
   if (auto *arg = args.getLastArg(OPT_m)) {
     StringRef s = arg->getValue();
@@ -2658,6 +2696,27 @@ static void initSectionsAndLocalSyms(ELFFileBase *file, bool ignoreComdats) {
   }
 }
 
+static void computeSymbolHashes(InputFile *file) {
+  if (file->kind() != InputFile::ObjKind)
+    return;
+  switch (cast<ELFFileBase>(file)->ekind) {
+  case ELF32LEKind:
+    cast<ObjFile<ELF32LE>>(file)->computeSymbolHashes();
+    break;
+  case ELF32BEKind:
+    cast<ObjFile<ELF32BE>>(file)->computeSymbolHashes();
+    break;
+  case ELF64LEKind:
+    cast<ObjFile<ELF64LE>>(file)->computeSymbolHashes();
+    break;
+  case ELF64BEKind:
+    cast<ObjFile<ELF64BE>>(file)->computeSymbolHashes();
+    break;
+  default:
+    llvm_unreachable("");
+  }
+}
+
 static void postParseObjectFile(ELFFileBase *file) {
   switch (file->ekind) {
   case ELF32LEKind:
@@ -2734,6 +2793,10 @@ void LinkerDriver::link(opt::InputArgList &args) {
   // appended to the Files vector.
   {
     llvm::TimeTraceScope timeScope("Parse input files");
+    // Symbol resolution is serial. Hash the global symbol names of relocatable
+    // object files and archive members in parallel first.
+    if (config->threadCount > 1)
+      parallelForEach(files, computeSymbolHashes);
     for (size_t i = 0; i < files.size(); ++i) {
       llvm::TimeTraceScope timeScope("Parse input files", files[i]->getName());
       parseFile(files[i]);
@@ -172,6 +172,7 @@ std::string elf::createResponseFile(const opt::InputArgList &args) {
     case OPT_o:
     case OPT_Map:
     case OPT_print_archive_stats:
+    case OPT_print_link_stats:
     case OPT_why_extract:
       // If an output path contains directories, "lld @response.txt" will
       // likely fail because the archive we are creating doesn't contain empty
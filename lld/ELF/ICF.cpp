@@ -80,6 +80,7 @@
 #include "SymbolTable.h"
 #include "Symbols.h"
 #include "SyntheticSections.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Object/ELF.h"
 #include "llvm/Support/Parallel.h"
@@ -435,20 +436,37 @@ void ICF<ELFT>::forEachClass(llvm::function_ref<void(size_t, size_t)> fn) {
   ++cnt;
 }
 
+// Hash everything equalsConstant compares exactly: section contents, flags, and
+// relocation offsets and types. Relocation targets and addends are left out.
+// In relocatable object files, the bytes at a relocated location are usually
+// zero, so sections that only differ in their relocations would otherwise
+// start out in the same equivalence class.
+template <class ELFT, class RelTy>
+static uint32_t getConstantHash(const InputSection *isec,
+                                ArrayRef<RelTy> rels) {
+  hash_code hash = hash_combine(xxh3_64bits(isec->content()), isec->flags);
+  for (const RelTy &rel : rels)
+    hash = hash_combine(hash, uint64_t(rel.r_offset),
+                        rel.getType(config->isMips64EL));
+  return hash;
+}
+
 // Combine the hashes of the sections referenced by the given section into its
-// hash.
+// hash. The combination depends on the relocation order so that, e.g., two
+// functions calling the same pair of functions in different orders get
+// different hashes.
 template <class ELFT, class RelTy>
 static void combineRelocHashes(unsigned cnt, InputSection *isec,
                                ArrayRef<RelTy> rels) {
-  uint32_t hash = isec->eqClass[cnt % 2];
+  hash_code hash = isec->eqClass[cnt % 2];
   for (RelTy rel : rels) {
     Symbol &s = isec->template getFile<ELFT>()->getRelocTargetSym(rel);
     if (auto *d = dyn_cast<Defined>(&s))
       if (auto *relSec = dyn_cast_or_null<InputSection>(d->section))
-        hash += relSec->eqClass[cnt % 2];
+        hash = hash_combine(hash, relSec->eqClass[cnt % 2]);
   }
   // Set MSB to 1 to avoid collisions with unique IDs.
-  isec->eqClass[(cnt + 1) % 2] = hash | (1U << 31);
+  isec->eqClass[(cnt + 1) % 2] = uint32_t(hash) | (1U << 31);
 }
 
 static void print(const Twine &s) {
@@ -493,8 +511,12 @@ template <class ELFT> void ICF<ELFT>::run() {
 
   // Initially, we use hash values to partition sections.
   parallelForEach(sections, [&](InputSection *s) {
+    const RelsOrRelas<ELFT> rels = s->template relsOrRelas<ELFT>();
+    uint32_t hash = rels.areRelocsRel()
+                        ? getConstantHash<ELFT>(s, rels.rels)
+                        : getConstantHash<ELFT>(s, rels.relas);
     // Set MSB to 1 to avoid collisions with unique IDs.
-    s->eqClass[0] = xxh3_64bits(s->content()) | (1U << 31);
+    s->eqClass[0] = hash | (1U << 31);
   });
 
   // Perform 2 rounds of relocation hash propagation. 2 is an empirical value to
@@ -533,6 +555,7 @@ template <class ELFT> void ICF<ELFT>::run() {
   } while (repeat);
 
   log("ICF needed " + Twine(cnt) + " iterations");
+  ctx.stats.icfIterations = cnt;
 
   // Merge sections by the equivalence class.
   forEachClassRange(0, sections.size(), [&](size_t begin, size_t end) {
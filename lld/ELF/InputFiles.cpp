@@ -1061,6 +1061,31 @@ InputSectionBase *ObjFile<ELFT>::createInputSection(uint32_t idx,
   return makeThreadLocal<InputSection>(*this, sec, name);
 }
 
+// Compute the symbol table hashes of the global symbol names. Symbol
+// resolution itself is order dependent and runs serially, so doing this ahead
+// of time in parallel takes the hashing off the serial path.
+template <class ELFT> void ObjFile<ELFT>::computeSymbolHashes() {
+  ArrayRef<Elf_Sym> eSyms = this->getELFSyms<ELFT>();
+  if (eSyms.size() <= firstGlobal)
+    return;
+  symbolHashes = std::make_unique<uint32_t[]>(eSyms.size() - firstGlobal);
+  for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i) {
+    // Leave invalid names alone. insertGlobal reports the error.
+    Expected<StringRef> name = eSyms[i].getName(stringTable);
+    if (name)
+      symbolHashes[i - firstGlobal] = SymbolTable::getNameHash(*name);
+    else
+      consumeError(name.takeError());
+  }
+}
+
+template <class ELFT> Symbol *ObjFile<ELFT>::insertGlobal(size_t i) {
+  StringRef name = CHECK(this->getELFSyms<ELFT>()[i].getName(stringTable), this);
+  if (symbolHashes)
+    return symtab.insert(name, symbolHashes[i - firstGlobal]);
+  return symtab.insert(name);
+}
+
 // Initialize symbols. symbols is a parallel array to the corresponding ELF
 // symbol table.
 template <class ELFT>
@@ -1074,7 +1099,8 @@ void ObjFile<ELFT>::initializeSymbols(const object::ELFFile<ELFT> &obj) {
   // Some entries have been filled by LazyObjFile.
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i)
     if (!symbols[i])
-      symbols[i] = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
+      symbols[i] = insertGlobal(i);
+  symbolHashes.reset();
 
   // Perform symbol resolution on non-local symbols.
   SmallVector<unsigned, 32> undefineds;
@@ -1815,11 +1841,12 @@ template <class ELFT> void ObjFile<ELFT>::parseLazy() {
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i) {
     if (eSyms[i].st_shndx == SHN_UNDEF)
       continue;
-    symbols[i] = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
+    symbols[i] = insertGlobal(i);
     symbols[i]->resolve(LazyObject{*this});
     if (!lazy)
       break;
   }
+  symbolHashes.reset();
 }
 
 bool InputFile::shouldExtractForCommon(StringRef name) {
@@ -50,6 +50,14 @@ void parseFile(InputFile *file);
 
 void parseArmCMSEImportLib(InputFile *file);
 
+// Used by --no-keep-memory to release a memory buffer once all input sections
+// backed by it have been written to the output. Files that share a buffer,
+// e.g. the members of an archive, share an instance.
+struct PendingBuffer {
+  MemoryBuffer *mb = nullptr;
+  std::atomic<uint32_t> numSections{0};
+};
+
 // The root class of input files.
 class InputFile {
 protected:
@@ -110,6 +118,9 @@ public:
   // Index of MIPS GOT built for this file.
   uint32_t mipsGotIndex = -1;
 
+  // Set with --no-keep-memory while the output is being written.
+  PendingBuffer *pendingBuffer = nullptr;
+
   // groupId is used for --warn-backrefs which is an optional error
   // checking feature. All files within the same --{start,end}-group or
   // --{start,end}-lib get the same group ID. Otherwise, each file gets a new
@@ -238,6 +249,7 @@ public:
 
   void parse(bool ignoreComdats = false);
   void parseLazy();
+  void computeSymbolHashes();
 
   StringRef getShtGroupSignature(ArrayRef<Elf_Shdr> sections,
                                  const Elf_Shdr &sec);
@@ -286,6 +298,10 @@ public:
   // Get cached DWARF information.
   DWARFCache *getDwarf();
 
+  // SymbolTable::getNameHash of the global symbol names, indexed from
+  // firstGlobal. Only set between computeSymbolHashes and symbol resolution.
+  std::unique_ptr<uint32_t[]> symbolHashes;
+
   void initSectionsAndLocalSyms(bool ignoreComdats);
   void postParse();
   void importCmseSymbols();
@@ -295,6 +311,7 @@ private:
                           const llvm::object::ELFFile<ELFT> &obj);
   void initializeSymbols(const llvm::object::ELFFile<ELFT> &obj);
   void initializeJustSymbols();
+  Symbol *insertGlobal(size_t i);
 
   InputSectionBase *getRelocTarget(uint32_t idx, const Elf_Shdr &sec,
                                    uint32_t info);
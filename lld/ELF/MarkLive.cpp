@@ -31,6 +31,7 @@
 #include "lld/Common/Strings.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/Object/ELF.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/TimeProfiler.h"
 #include <vector>
 
@@ -50,10 +51,24 @@ public:
   void moveToMain();
 
 private:
+  // A relocation, resolved to the symbol it refers to and, if it can make a
+  // section live, the target section and offset.
+  struct Edge {
+    Symbol *sym;
+    InputSectionBase *sec;
+    uint64_t offset;
+  };
+
   void enqueue(InputSectionBase *sec, uint64_t offset);
   void markSymbol(Symbol *sym);
   void mark();
 
+  template <class RelTy>
+  Edge getEdge(InputSectionBase &sec, const RelTy &rel, bool fromFDE) const;
+  void visitEdge(const Edge &edge);
+  void collectEdges(InputSectionBase &sec, SmallVectorImpl<Edge> &edges) const;
+  void visitSection(InputSectionBase &sec, ArrayRef<Edge> edges);
+
   template <class RelTy>
   void resolveReloc(InputSectionBase &sec, RelTy &rel, bool fromFDE);
 
@@ -85,37 +100,50 @@ static uint64_t getAddend(InputSectionBase &sec,
   return rel.r_addend;
 }
 
+// Resolve a relocation of sec. This only reads the input, so it can be called
+// for different sections in parallel.
 template <class ELFT>
 template <class RelTy>
-void MarkLive<ELFT>::resolveReloc(InputSectionBase &sec, RelTy &rel,
-                                  bool fromFDE) {
+typename MarkLive<ELFT>::Edge
+MarkLive<ELFT>::getEdge(InputSectionBase &sec, const RelTy &rel,
+                        bool fromFDE) const {
   Symbol &sym = sec.getFile<ELFT>()->getRelocTargetSym(rel);
+  auto *d = dyn_cast<Defined>(&sym);
+  if (!d)
+    return {&sym, nullptr, 0};
+  auto *relSec = dyn_cast_or_null<InputSectionBase>(d->section);
+  if (!relSec)
+    return {&sym, nullptr, 0};
+
+  uint64_t offset = d->value;
+  if (d->isSection())
+    offset += getAddend<ELFT>(sec, rel);
+
+  // fromFDE being true means this is referenced by a FDE in a .eh_frame
+  // piece. The relocation points to the described function or to a LSDA. We
+  // only need to keep the LSDA live, so ignore anything that points to
+  // executable sections. If the LSDA is in a section group or has the
+  // SHF_LINK_ORDER flag, we ignore the relocation as well because (a) if the
+  // associated text section is live, the LSDA will be retained due to section
+  // group/SHF_LINK_ORDER rules (b) if the associated text section should be
+  // discarded, marking the LSDA will unnecessarily retain the text section.
+  if (fromFDE && ((relSec->flags & (SHF_EXECINSTR | SHF_LINK_ORDER)) ||
+                  relSec->nextInSectionGroup))
+    return {&sym, nullptr, 0};
+  return {&sym, relSec, offset};
+}
 
+template <class ELFT> void MarkLive<ELFT>::visitEdge(const Edge &edge) {
   // If a symbol is referenced in a live section, it is used.
+  Symbol &sym = *edge.sym;
   sym.used = true;
 
-  if (auto *d = dyn_cast<Defined>(&sym)) {
-    auto *relSec = dyn_cast_or_null<InputSectionBase>(d->section);
-    if (!relSec)
-      return;
-
-    uint64_t offset = d->value;
-    if (d->isSection())
-      offset += getAddend<ELFT>(sec, rel);
-
-    // fromFDE being true means this is referenced by a FDE in a .eh_frame
-    // piece. The relocation points to the described function or to a LSDA. We
-    // only need to keep the LSDA live, so ignore anything that points to
-    // executable sections. If the LSDA is in a section group or has the
-    // SHF_LINK_ORDER flag, we ignore the relocation as well because (a) if the
-    // associated text section is live, the LSDA will be retained due to section
-    // group/SHF_LINK_ORDER rules (b) if the associated text section should be
-    // discarded, marking the LSDA will unnecessarily retain the text section.
-    if (!(fromFDE && ((relSec->flags & (SHF_EXECINSTR | SHF_LINK_ORDER)) ||
-                      relSec->nextInSectionGroup)))
-      enqueue(relSec, offset);
+  if (edge.sec) {
+    enqueue(edge.sec, edge.offset);
     return;
   }
+  if (isa<Defined>(sym))
+    return;
 
   if (auto *ss = dyn_cast<SharedSymbol>(&sym))
     if (!ss->isWeak())
@@ -125,6 +153,13 @@ void MarkLive<ELFT>::resolveReloc(InputSectionBase &sec, RelTy &rel,
     enqueue(sec, 0);
 }
 
+template <class ELFT>
+template <class RelTy>
+void MarkLive<ELFT>::resolveReloc(InputSectionBase &sec, RelTy &rel,
+                                  bool fromFDE) {
+  visitEdge(getEdge(sec, rel, fromFDE));
+}
+
 // The .eh_frame section is an unfortunate special case.
 // The section is divided in CIEs and FDEs and the relocations it can have are
 // * CIEs can refer to a personality function.
@@ -302,23 +337,60 @@ template <class ELFT> void MarkLive<ELFT>::run() {
   mark();
 }
 
+template <class ELFT>
+void MarkLive<ELFT>::collectEdges(InputSectionBase &sec,
+                                  SmallVectorImpl<Edge> &edges) const {
+  const RelsOrRelas<ELFT> rels = sec.template relsOrRelas<ELFT>();
+  for (const typename ELFT::Rel &rel : rels.rels)
+    edges.push_back(getEdge(sec, rel, false));
+  for (const typename ELFT::Rela &rel : rels.relas)
+    edges.push_back(getEdge(sec, rel, false));
+}
+
+template <class ELFT>
+void MarkLive<ELFT>::visitSection(InputSectionBase &sec, ArrayRef<Edge> edges) {
+  for (const Edge &edge : edges)
+    visitEdge(edge);
+
+  for (InputSectionBase *isec : sec.dependentSections)
+    enqueue(isec, 0);
+
+  // Mark the next group member.
+  if (sec.nextInSectionGroup)
+    enqueue(sec.nextInSectionGroup, 0);
+}
+
 template <class ELFT> void MarkLive<ELFT>::mark() {
   // Mark all reachable sections.
+  //
+  // Resolving relocations is the expensive part and only reads the input, so
+  // when the queue is large, do it for a batch of sections in parallel. Edges
+  // are then visited serially, which keeps the liveness and partition updates
+  // single-threaded. The set of live sections does not depend on the visiting
+  // order.
+  const size_t minParallelBatch = 64, maxBatch = 4096;
+  bool useThreads = config->threadCount > 1;
+  SmallVector<Edge, 0> edges;
+  SmallVector<SmallVector<Edge, 0>, 0> batchEdges;
   while (!queue.empty()) {
-    InputSectionBase &sec = *queue.pop_back_val();
-
-    const RelsOrRelas<ELFT> rels = sec.template relsOrRelas<ELFT>();
-    for (const typename ELFT::Rel &rel : rels.rels)
-      resolveReloc(sec, rel, false);
-    for (const typename ELFT::Rela &rel : rels.relas)
-      resolveReloc(sec, rel, false);
-
-    for (InputSectionBase *isec : sec.dependentSections)
-      enqueue(isec, 0);
+    if (!useThreads || queue.size() < minParallelBatch) {
+      InputSectionBase &sec = *queue.pop_back_val();
+      edges.clear();
+      collectEdges(sec, edges);
+      visitSection(sec, edges);
+      continue;
+    }
 
-    // Mark the next group member.
-    if (sec.nextInSectionGroup)
-      enqueue(sec.nextInSectionGroup, 0);
+    size_t n = std::min(queue.size(), maxBatch);
+    SmallVector<InputSection *, 0> batch(queue.end() - n, queue.end());
+    queue.truncate(queue.size() - n);
+    batchEdges.resize(n);
+    parallelFor(0, n, [&](size_t i) {
+      batchEdges[i].clear();
+      collectEdges(*batch[i], batchEdges[i]);
+    });
+    for (size_t i = 0; i != n; ++i)
+      visitSection(*batch[i], batchEdges[i]);
   }
 }
 
@@ -1558,16 +1558,22 @@ template <class ELFT> void elf::scanRelocations() {
                 config->emachine == EM_PPC64;
   parallel::TaskGroup tg;
   for (ELFFileBase *f : ctx.objectFiles) {
-    auto fn = [f]() {
-      RelocationScanner scanner;
-      for (InputSectionBase *s : f->getSections()) {
-        if (s && s->kind() == SectionBase::Regular && s->isLive() &&
-            (s->flags & SHF_ALLOC) &&
-            !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
-          scanner.template scanSection<ELFT>(*s);
-      }
-    };
-    tg.spawn(fn, serial);
+    // Split files with many sections, typically the output of LTO, into
+    // multiple tasks so that a single large file does not serialize the scan.
+    const size_t chunkSize = 1024;
+    ArrayRef<InputSectionBase *> sections = f->getSections();
+    for (size_t i = 0; i < sections.size(); i += chunkSize) {
+      auto fn = [chunk = sections.slice(i).take_front(chunkSize)]() {
+        RelocationScanner scanner;
+        for (InputSectionBase *s : chunk) {
+          if (s && s->kind() == SectionBase::Regular && s->isLive() &&
+              (s->flags & SHF_ALLOC) &&
+              !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
+            scanner.template scanSection<ELFT>(*s);
+        }
+      };
+      tg.spawn(fn, serial);
+    }
   }
 
   tg.spawn([] {
@@ -43,6 +43,9 @@ public:
   void wrap(Symbol *sym, Symbol *real, Symbol *wrap);
 
   Symbol *insert(StringRef name);
+  // Same as above, but takes a precomputed getNameHash(name).
+  Symbol *insert(StringRef name, uint32_t hash);
+  static uint32_t getNameHash(StringRef name);
 
   template <typename T> Symbol *addSymbol(const T &newSym) {
     Symbol *sym = insert(newSym.getName());
@@ -583,6 +583,51 @@ template <class ELFT> void elf::createSyntheticSections() {
     add(*in.strTab);
 }
 
+// With --no-keep-memory, count the input sections that will be copied to the
+// output for each input memory buffer. OutputSection::writeTo decrements the
+// count and marks the buffer MADV_DONTNEED when it drops to zero, so that the
+// inputs do not all stay resident until the link finishes. The buffers remain
+// mapped, so a later access (e.g. a symbol name) faults the pages back in.
+static std::unique_ptr<PendingBuffer[]> trackInputBuffers() {
+  auto ret = std::make_unique<PendingBuffer[]>(ctx.memoryBuffers.size());
+  SmallVector<PendingBuffer *, 0> sorted;
+  for (auto [i, mb] : llvm::enumerate(ctx.memoryBuffers)) {
+    ret[i].mb = mb.get();
+    sorted.push_back(&ret[i]);
+  }
+  llvm::sort(sorted, [](const PendingBuffer *a, const PendingBuffer *b) {
+    return a->mb->getBufferStart() < b->mb->getBufferStart();
+  });
+
+  // Archive members point into the buffer of the archive, so look for the
+  // buffer that contains the file.
+  auto findBuffer = [&](const InputFile *file) -> PendingBuffer * {
+    const char *p = file->mb.getBufferStart();
+    auto it = llvm::upper_bound(sorted, p,
+                                [](const char *p, const PendingBuffer *b) {
+                                  return p < b->mb->getBufferStart();
+                                });
+    if (it == sorted.begin())
+      return nullptr;
+    PendingBuffer *b = *std::prev(it);
+    return p < b->mb->getBufferEnd() ? b : nullptr;
+  };
+
+  for (InputSectionBase *sec : ctx.inputSections) {
+    auto *isec = dyn_cast<InputSection>(sec);
+    if (!isec || isa<SyntheticSection>(isec) || !isec->file ||
+        !isec->isLive() || !isec->getParent() ||
+        isec->getParent()->type == SHT_NOBITS)
+      continue;
+    InputFile *file = isec->file;
+    if (!file->pendingBuffer)
+      file->pendingBuffer = findBuffer(file);
+    if (file->pendingBuffer)
+      ++file->pendingBuffer->numSections;
+  }
+  return ret;
+}
+
 // The main function of the writer.
 template <class ELFT> void Writer<ELFT>::run() {
   // Now that we have a complete set of output sections. This function
@@ -592,6 +637,12 @@ template <class ELFT> void Writer<ELFT>::run() {
   finalizeSections();
   checkExecuteOnly();
 
+  // Debug sections are written to a temporary buffer by maybeCompress, so start
+  // tracking before that.
+  std::unique_ptr<PendingBuffer[]> pendingBuffers;
+  if (config->noKeepMemory)
+    pendingBuffers = trackInputBuffers();
+
   // If --compressed-debug-sections is specified, compress .debug_* sections.
   // Do it right now because it changes the size of output sections.
   for (OutputSection *sec : outputSections)
@@ -1743,6 +1794,7 @@ template <class ELFT> void Writer<ELFT>::finalizeAddressDependentContent() {
       }
     }
   }
+  ctx.stats.thunkPasses = pass;
   if (!config->relocatable && config->emachine == EM_RISCV)
     riscvFinalizeRelax(pass);
 
@@ -2998,19 +3050,25 @@ template <class ELFT> void Writer<ELFT>::writeTrapInstr() {
 template <class ELFT> void Writer<ELFT>::writeSections() {
   llvm::TimeTraceScope timeScope("Write sections");
 
-  {
-    // In -r or --emit-relocs mode, write the relocation sections first as in
-    // ELf_Rel targets we might find out that we need to modify the relocated
-    // section while doing it.
+  auto isRelSection = [](OutputSection *sec) {
+    return sec->type == SHT_REL || sec->type == SHT_RELA;
+  };
+
+  // In -r or --emit-relocs mode, write the relocation sections first as in
+  // ELf_Rel targets we might find out that we need to modify the relocated
+  // section while doing it. Otherwise, relocation sections (e.g. .rela.dyn)
+  // don't touch other sections, so write everything in one task group and let
+  // large dynamic relocation sections overlap with the rest of the output.
+  if (config->copyRelocs) {
     parallel::TaskGroup tg;
     for (OutputSection *sec : outputSections)
-      if (sec->type == SHT_REL || sec->type == SHT_RELA)
+      if (isRelSection(sec))
         sec->writeTo<ELFT>(Out::bufferStart + sec->offset, tg);
   }
   {
     parallel::TaskGroup tg;
     for (OutputSection *sec : outputSections)
-      if (sec->type != SHT_REL && sec->type != SHT_RELA)
+      if (!config->copyRelocs || !isRelSection(sec))
         sec->writeTo<ELFT>(Out::bufferStart + sec->offset, tg);
   }
 
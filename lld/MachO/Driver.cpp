@@ -1975,9 +1975,9 @@ bool link(ArrayRef<const char *> argsArr, llvm::raw_ostream &stdoutOS,
     if (config->icfLevel != ICFLevel::none) {
       if (config->icfLevel == ICFLevel::safe)
         markAddrSigSymbols();
-      foldIdenticalSections(/*onlyCfStrings=*/false);
+      foldIdenticalSections(/*onlyLiterals=*/false);
     } else if (config->dedupStrings) {
-      foldIdenticalSections(/*onlyCfStrings=*/true);
+      foldIdenticalSections(/*onlyLiterals=*/true);
     }
 
     // Write to an output file.
@@ -395,7 +395,7 @@ void macho::markAddrSigSymbols() {
   }
 }
 
-void macho::foldIdenticalSections(bool onlyCfStrings) {
+void macho::foldIdenticalSections(bool onlyLiterals) {
   TimeTraceScope timeScope("Fold Identical Code Sections");
   // The ICF equivalence-class segregation algorithm relies on pre-computed
   // hashes of InputSection::data for the ConcatOutputSection::inputs and all
@@ -422,7 +422,8 @@ void macho::foldIdenticalSections(bool onlyCfStrings) {
     bool hasFoldableFlags = (isSelRefsSection(isec) ||
                              sectionType(isec->getFlags()) == MachO::S_REGULAR);
     // FIXME: consider non-code __text sections as foldable?
-    bool isFoldable = (!onlyCfStrings || isCfStringSection(isec)) &&
+    bool isLiteral = isCfStringSection(isec) || isSelRefsSection(isec);
+    bool isFoldable = (!onlyLiterals || isLiteral) &&
                       (isCodeSection(isec) || isFoldableWithAddendsRemoved ||
                        isGccExceptTabSection(isec)) &&
                       !isec->keepUnique && !isec->hasAltEntry &&
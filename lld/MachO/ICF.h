@@ -18,7 +18,9 @@ class Symbol;
 
 void markAddrSigSymbols();
 void markSymAsAddrSig(Symbol *s);
-void foldIdenticalSections(bool onlyCfStrings);
+// If onlyLiterals is true, only fold __cfstring and __objc_selrefs sections,
+// which is always safe.
+void foldIdenticalSections(bool onlyLiterals);
 
 } // namespace lld::macho
 
@@ -1215,21 +1215,35 @@ void Writer::buildFixupChains() {
   const uint64_t pageSize = target->getPageSize();
   constexpr uint32_t stride = 4; // for DYLD_CHAINED_PTR_64
 
-  for (size_t i = 0, count = loc.size(); i < count;) {
-    const OutputSegment *oseg = loc[i].isec->parent->parent;
+  // Chains never cross page boundaries, so find the first fixup of each page
+  // and link the pages in parallel. Errors are recorded per page and only the
+  // first one in page order is reported, as a serial walk would.
+  auto samePage = [&](const Location &a, const Location &b) {
+    return a.isec->parent->parent == b.isec->parent->parent &&
+           a.offset / pageSize == b.offset / pageSize;
+  };
+  SmallVector<size_t, 0> pageStarts;
+  for (size_t i = 0, count = loc.size(); i < count; ++i)
+    if (i == 0 || !samePage(loc[i - 1], loc[i]))
+      pageStarts.push_back(i);
+  pageStarts.push_back(loc.size());
+  const size_t numPages = pageStarts.size() - 1;
+  auto errors = std::make_unique<std::string[]>(numPages);
+
+  parallelFor(0, numPages, [&](size_t page) {
+    const OutputSegment *oseg = loc[pageStarts[page]].isec->parent->parent;
     uint8_t *buf = buffer->getBufferStart() + oseg->fileOff;
-    uint64_t pageIdx = loc[i].offset / pageSize;
-    ++i;
 
-    while (i < count && loc[i].isec->parent->parent == oseg &&
-           (loc[i].offset / pageSize) == pageIdx) {
+    for (size_t i = pageStarts[page] + 1; i < pageStarts[page + 1]; ++i) {
       uint64_t offset = loc[i].offset - loc[i - 1].offset;
 
       auto fail = [&](Twine message) {
-        error(loc[i].isec->getSegName() + "," + loc[i].isec->getName() +
-              ", offset " +
-              Twine(loc[i].offset - loc[i].isec->parent->getSegmentOffset()) +
-              ": " + message);
+        errors[page] =
+            (loc[i].isec->getSegName() + "," + loc[i].isec->getName() +
+             ", offset " +
+             Twine(loc[i].offset - loc[i].isec->parent->getSegmentOffset()) +
+             ": " + message)
+                .str();
       };
 
       if (offset < target->wordSize)
@@ -1242,7 +1256,13 @@ void Writer::buildFixupChains() {
       // The "next" field is in the same location for bind and rebase entries.
       reinterpret_cast<dyld_chained_ptr_64_bind *>(buf + loc[i - 1].offset)
           ->next = offset / stride;
-      ++i;
+    }
+  });
+
+  for (size_t page = 0; page != numPages; ++page) {
+    if (!errors[page].empty()) {
+      error(errors[page]);
+      return;
     }
   }
 }
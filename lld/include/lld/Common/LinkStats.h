@@ -0,0 +1,44 @@
+//===- LinkStats.h ----------------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Counters describing a link, written as JSON by --print-link-stats=. The field
+// names are shared by all ports and are meant to be consumed by tools that
+// track link performance over time, so they should not be renamed. Only the
+// ELF port fills them in so far.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLD_COMMON_LINKSTATS_H
+#define LLD_COMMON_LINKSTATS_H
+
+#include "llvm/Support/raw_ostream.h"
+#include <cstdint>
+
+namespace lld {
+
+struct LinkStats {
+  // Bump when a field changes meaning or is removed.
+  static constexpr unsigned version = 2;
+
+  uint64_t inputFiles = 0;
+  uint64_t inputBytes = 0;
+  uint64_t inputSections = 0;
+  uint64_t symbols = 0;
+  uint64_t relocations = 0;
+  uint64_t icfIterations = 0;
+  uint64_t thunkPasses = 0;
+  uint64_t outputSections = 0;
+
+  // Writes the counters and, where the host reports it, the peak resident set
+  // size of the process as a JSON object.
+  void write(llvm::raw_ostream &os) const;
+};
+
+} // namespace lld
+
+#endif
@@ -78,10 +78,14 @@ void CodeSection::writeTo(uint8_t *buf) {
 
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
+}
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
-    chunk->writeTo(buf);
+void CodeSection::writeBodies(uint8_t *buf) const {
+  // The offsets of the bodies were assigned in finalizeContents(), so they
+  // can be written and relocated in parallel.
+  buf += offset + header.size();
+  parallelForEach(functions,
+                  [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
 }
 
 uint32_t CodeSection::getNumRelocations() const {
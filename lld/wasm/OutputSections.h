@@ -63,7 +63,10 @@ public:
   }
 
   size_t getSize() const override { return header.size() + bodySize; }
+  // Only writes the section headers. The function bodies are written by
+  // writeBodies().
   void writeTo(uint8_t *buf) override;
+  void writeBodies(uint8_t *buf) const;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override { return functions.size() > 0; }
@@ -86,7 +89,10 @@ public:
   }
 
   size_t getSize() const override { return header.size() + bodySize; }
+  // Only writes the section headers. The function bodies are written by
+  // writeBodies().
   void writeTo(uint8_t *buf) override;
+  void writeBodies(uint8_t *buf) const;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override;
@@ -223,6 +223,11 @@ void Writer::writeSections() {
     assert(s->isNeeded());
     s->writeTo(buf);
   });
+  // Function bodies usually make up most of the output. Write them in their
+  // own parallel loop, since one nested in the loop above would run serially.
+  for (OutputSection *s : outputSections)
+    if (auto *code = dyn_cast<CodeSection>(s))
+      code->writeBodies(buf);
 }
 
 // Computes a hash value of Data using a given hash function.
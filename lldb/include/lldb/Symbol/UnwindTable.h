@@ -19,7 +19,9 @@ namespace lldb_private {
 
 // A class which holds all the FuncUnwinders objects for a given ObjectFile.
 // The UnwindTable is populated with FuncUnwinders objects lazily during the
-// debug session.
+// debug session. It is owned by the Module, so the unwind plans built while
+// backtracing one thread are reused when any other thread unwinds through the
+// same function.
 
 class UnwindTable {
 public:
@@ -249,6 +249,10 @@ bool BreakpointLocation::ConditionSaysStop(ExecutionContext &exe_ctx,
 
   DiagnosticManager diagnostics;
 
+  // The parsed condition is cached per location and only rebuilt when the
+  // condition text or the expression's context changes. Parsing with
+  // eExecutionPolicyOnlyWhenNeeded lets conditions the IRInterpreter can
+  // handle run without JITting code into the inferior.
   if (condition_hash != m_condition_hash || !m_user_expression_sp ||
       !m_user_expression_sp->MatchesContext(exe_ctx)) {
     LanguageType language = eLanguageTypeUnknown;
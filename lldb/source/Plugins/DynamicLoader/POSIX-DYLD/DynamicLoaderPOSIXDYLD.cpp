@@ -10,6 +10,7 @@
 #include "DynamicLoaderPOSIXDYLD.h"
 
 #include "lldb/Breakpoint/BreakpointLocation.h"
+#include "lldb/Core/Debugger.h"
 #include "lldb/Core/Module.h"
 #include "lldb/Core/ModuleSpec.h"
 #include "lldb/Core/PluginManager.h"
@@ -24,6 +25,7 @@
 #include "lldb/Utility/LLDBLog.h"
 #include "lldb/Utility/Log.h"
 #include "lldb/Utility/ProcessInfo.h"
+#include "llvm/Support/ThreadPool.h"
 
 #include <memory>
 #include <optional>
@@ -612,6 +614,35 @@ ModuleSP DynamicLoaderPOSIXDYLD::LoadModuleAtAddress(const FileSpec &file,
   return nullptr;
 }
 
+/// Create the modules for \p files and preload their symbols concurrently on
+/// the debugger's thread pool. The modules land in the shared module cache, so
+/// the sequential loading that follows finds them already parsed, and the
+/// order in which they are added to the target stays deterministic.
+static void PreloadModules(Target &target, llvm::ArrayRef<FileSpec> files) {
+  // Only the host platform resolves modules without talking to a remote
+  // connection, which must not be used from several threads.
+  PlatformSP platform_sp = target.GetPlatform();
+  if (!target.GetPreloadSymbols() || !platform_sp || !platform_sp->IsHost() ||
+      files.size() < 2)
+    return;
+
+  FileSpecList search_paths = target.GetExecutableSearchPaths();
+  llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
+  for (const FileSpec &file : files) {
+    task_group.async([&target, &platform_sp, &search_paths, file]() {
+      ModuleSpec module_spec(file, target.GetArchitecture());
+      if (target.GetImages().FindFirstModule(module_spec))
+        return;
+      ModuleSP module_sp;
+      platform_sp->GetSharedModule(module_spec, nullptr, module_sp,
+                                   &search_paths, nullptr, nullptr);
+      if (module_sp)
+        module_sp->PreloadSymbols();
+    });
+  }
+  task_group.wait();
+}
+
 void DynamicLoaderPOSIXDYLD::LoadAllCurrentModules() {
   DYLDRendezvous::iterator I;
   DYLDRendezvous::iterator E;
@@ -638,6 +669,7 @@ void DynamicLoaderPOSIXDYLD::LoadAllCurrentModules() {
     module_names.push_back(I->file_spec);
   m_process->PrefetchModuleSpecs(
       module_names, m_process->GetTarget().GetArchitecture().GetTriple());
+  PreloadModules(m_process->GetTarget(), module_names);
 
   for (I = m_rendezvous.begin(), E = m_rendezvous.end(); I != E; ++I) {
     ModuleSP module_sp =
@@ -400,7 +400,12 @@ size_t ProcessElfCore::DoReadMemory(lldb::addr_t addr, void *buf, size_t size,
   if (bytes_to_read > bytes_left)
     bytes_to_read = bytes_left;
 
-  // If there is data available on the core file read it
+  // If there is data available on the core file read it. The core object
+  // file's data comes from ObjectFileELF::MapFileDataWritable, i.e.
+  // FileSystem::CreateWritableDataBuffer, which maps local files privately,
+  // so only the pages touched here are ever read from disk.
+  // Files on network file systems are read into memory up front instead,
+  // since a mapping could fault if the file changed underneath us.
   if (bytes_to_read)
     bytes_copied =
         core_objfile->CopyData(offset + file_start, bytes_to_read, buf);
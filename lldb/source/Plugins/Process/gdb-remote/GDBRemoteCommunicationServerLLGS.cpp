@@ -2894,6 +2894,9 @@ GDBRemoteCommunicationServerLLGS::Handle_Z(StringExtractorGDBRemote &packet) {
     return SendIllFormedResponse(
         packet, "Malformed Z packet, failed to parse size argument");
 
+  // Any trailing ";cond_list" of GDB agent expressions is ignored: we do not
+  // advertise ConditionalBreakpoints in qSupported, so breakpoint conditions
+  // are always evaluated by the client after the inferior stops.
   if (want_breakpoint) {
     // Try to set the breakpoint.
     const Status error =
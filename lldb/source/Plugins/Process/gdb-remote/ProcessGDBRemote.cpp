@@ -2534,6 +2534,10 @@ void ProcessGDBRemote::WillPublicStop() {
 }
 
 // Process Memory
+// Each call costs one round trip. Small reads normally reach this function
+// through Process::ReadMemory, whose MemoryCache rounds them up to
+// target.process.memory-cache-line-size, so raising that setting is the way
+// to trade bandwidth for fewer round trips on high latency links.
 size_t ProcessGDBRemote::DoReadMemory(addr_t addr, void *buf, size_t size,
                                       Status &error) {
   GetMaxMemorySize();
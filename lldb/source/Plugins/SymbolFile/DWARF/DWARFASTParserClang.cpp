@@ -3102,6 +3102,11 @@ void DWARFASTParserClang::ParseSingleMember(
     }
   }
 
+  // Clang needs the definition of every by-value member to lay out the
+  // record, so completing a class transitively completes all of its by-value
+  // members (and base classes). Members reached through pointers and
+  // references are left as forward declarations and are only completed on
+  // demand through SymbolFileDWARF::CompleteType.
   TypeSystemClang::RequireCompleteType(member_clang_type);
 
   clang::FieldDecl *field_decl = TypeSystemClang::AddFieldToRecordType(
@@ -102,13 +102,23 @@ bool NameToDIE::Decode(const DataExtractor &data, lldb::offset_t *offset_ptr,
     return false;
   const uint32_t count = data.GetU32(offset_ptr);
   m_map.Reserve(count);
+  // Entries were encoded from a sorted map, so all entries for one name are
+  // adjacent and share a string table offset. Only create a ConstString when
+  // the name changes, which avoids a string pool lookup per entry.
+  uint32_t prev_stroff = 0;
+  ConstString name;
   for (uint32_t i = 0; i < count; ++i) {
-    llvm::StringRef str(strtab.Get(data.GetU32(offset_ptr)));
-    // No empty strings allowed in the name to DIE maps.
-    if (str.empty())
-      return false;
+    const uint32_t stroff = data.GetU32(offset_ptr);
+    if (i == 0 || stroff != prev_stroff) {
+      llvm::StringRef str(strtab.Get(stroff));
+      // No empty strings allowed in the name to DIE maps.
+      if (str.empty())
+        return false;
+      name = ConstString(str);
+      prev_stroff = stroff;
+    }
     if (std::optional<DIERef> die_ref = DIERef::Decode(data, offset_ptr))
-      m_map.Append(ConstString(str), *die_ref);
+      m_map.Append(name, *die_ref);
     else
       return false;
   }
@@ -0,0 +1,31 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/DenseMap.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Lookups of pointer keys, the most common DenseMap use in the compiler.
+// Half of the queried keys are present and half are not, in random order.
+static void BM_DenseMapPointerLookup(benchmark::State &state) {
+  size_t NumKeys = state.range(0);
+  std::vector<int> Storage(2 * NumKeys);
+  std::vector<const int *> Queries;
+  llvm::DenseMap<const int *, unsigned> Map;
+  for (size_t I = 0; I != 2 * NumKeys; ++I) {
+    if (I % 2 == 0)
+      Map[&Storage[I]] = I;
+    Queries.push_back(&Storage[I]);
+  }
+  std::shuffle(Queries.begin(), Queries.end(), std::mt19937(0));
+
+  for (auto _ : state) {
+    unsigned Found = 0;
+    for (const int *Q : Queries)
+      Found += Map.count(Q);
+    benchmark::DoNotOptimize(Found);
+  }
+  state.SetItemsProcessed(state.iterations() * Queries.size());
+}
+BENCHMARK(BM_DenseMapPointerLookup)->Range(1 << 6, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,17 @@
+#include "benchmark/benchmark.h"
+#include "llvm/Support/Parallel.h"
+#include <vector>
+
+// Cost of scheduling a parallelFor whose per-item work is tiny, so that the
+// executor overhead dominates.
+static void BM_ParallelForSmallItems(benchmark::State &state) {
+  std::vector<unsigned> V(state.range(0));
+  for (auto _ : state) {
+    llvm::parallelFor(0, V.size(), [&](size_t I) { V[I] += I; });
+    benchmark::DoNotOptimize(V.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelForSmallItems)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -73,6 +73,10 @@ enum {
   /// - UpperBound - numerically maximum + 1 opcode supported
   /// - Default - failure jump target
   /// - JumpTable... - (UpperBound - LowerBound) (at least 2) jump targets
+  ///
+  /// With -optimize-match-table (the default) TableGen groups the rules of both
+  /// the instruction selector and the combiners under a root GIM_SwitchOpcode,
+  /// so matching an instruction only walks the rules for its opcode.
   GIM_SwitchOpcode,
 
   /// Switch over the LLT on the specified instruction operand
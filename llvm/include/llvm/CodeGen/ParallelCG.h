@@ -32,6 +32,12 @@ class raw_pwrite_stream;
 ///
 /// Writes bitcode for individual partitions into output streams in BCOSs, if
 /// BCOSs is not empty.
+///
+/// Each partition is cloned into its own LLVMContext because codegen of a
+/// single module is not thread-safe: IR constants and metadata are uniqued in
+/// the shared LLVMContext, and MachineModuleInfo, MCContext symbol creation
+/// and the AsmPrinter all keep per-module state that is updated as each
+/// function is emitted.
 void splitCodeGen(
     Module &M, ArrayRef<raw_pwrite_stream *> OSs,
     ArrayRef<llvm::raw_pwrite_stream *> BCOSs,
@@ -117,6 +117,10 @@ public:
   /// skip information that doesn't match. This avoids memory allocations and
   /// is much faster for lookups.
   ///
+  /// The strings in the returned LookupResult point into the GSYM data, so no
+  /// string data is copied. Lookups do not modify the reader, so one reader
+  /// can serve lookups from many threads at once.
+  ///
   /// \param Addr A virtual address from the orignal object file to lookup.
   /// \returns An expected LookupResult that contains only the information
   /// needed for the current address, or an error object that indicates reason
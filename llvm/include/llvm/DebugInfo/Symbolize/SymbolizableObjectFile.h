@@ -93,6 +93,16 @@ private:
   // (index, filename) pairs of ELF STT_FILE symbols.
   std::vector<std::pair<uint32_t, StringRef>> FileSymbols;
 
+  struct TextSectionDesc {
+    uint64_t Addr;
+    uint64_t Size;
+    uint64_t Index;
+  };
+  // Non-empty, non-virtual text sections of Module. Sorted by address if
+  // TextSectionsSorted is set, otherwise in section table order.
+  std::vector<TextSectionDesc> TextSections;
+  bool TextSectionsSorted = false;
+
   SymbolizableObjectFile(const object::ObjectFile *Obj,
                          std::unique_ptr<DIContext> DICtx,
                          bool UntagAddresses);
@@ -47,6 +47,13 @@ using FileLineInfoKind = DILineInfoSpecifier::FileLineInfoKind;
 
 class CachedBinary;
 
+/// Symbolizes addresses in binaries, caching the loaded binaries and their
+/// debug info contexts across queries.
+///
+/// An LLVMSymbolizer is not thread-safe: every query may load, insert or
+/// evict cache entries, and the DIContexts it owns parse debug info lazily
+/// without locking. Clients that want to symbolize concurrently should either
+/// serialize access to one instance or give each thread its own instance.
 class LLVMSymbolizer {
 public:
   struct Options {
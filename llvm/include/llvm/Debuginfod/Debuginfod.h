@@ -29,6 +29,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/RWMutex.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/Timer.h"
 
 #include <chrono>
@@ -67,6 +68,14 @@ Expected<std::string> getCachedOrDownloadExecutable(object::BuildIDRef ID);
 /// server URLs.
 Expected<std::string> getCachedOrDownloadDebuginfo(object::BuildIDRef ID);
 
+/// Fetches the debug binaries for all of \p IDs concurrently, using the
+/// default local cache directory and server URLs. Returns the cached file
+/// paths in the order of \p IDs; the path is empty for artifacts that could
+/// not be found or fetched.
+std::vector<std::string>
+prefetchDebuginfo(ArrayRef<object::BuildIDRef> IDs,
+                  ThreadPoolStrategy S = hardware_concurrency());
+
 /// Fetches any debuginfod artifact using the default local cache directory and
 /// server URLs.
 Expected<std::string> getCachedOrDownloadArtifact(StringRef UniqueKey,
@@ -9,6 +9,11 @@
 // JIT layer for breaking up modules and inserting callbacks to allow
 // individual functions to be compiled on demand.
 //
+// Each function is compiled once, at the optimization level of the layers
+// below. Calls go through stubs owned by the IndirectStubsManager, so a client
+// that wants to recompile a hot function can compile a new definition under a
+// different name and repoint the stub with IndirectStubsManager::updatePointer.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_EXECUTIONENGINE_ORC_COMPILEONDEMANDLAYER_H
@@ -322,6 +322,7 @@ public:
   unique_function<Error(LLJIT &)> PrePlatformSetup;
   PlatformSetupFunction SetUpPlatform;
   unsigned NumCompileThreads = 0;
+  ObjectCache *ObjCache = nullptr;
 
   /// Called prior to JIT class construcion to fix up defaults.
   Error prepareForConstruction();
@@ -454,6 +455,17 @@ public:
     return impl();
   }
 
+  /// Set an ObjectCache for the default compile function to query before
+  /// compiling a module, and to notify with each newly compiled object.
+  ///
+  /// The cache must outlive the JIT instance, and must be thread-safe if a
+  /// non-zero number of compile threads is used. It is ignored if a custom
+  /// compile function creator has been set.
+  SetterImpl &setObjectCache(ObjectCache *ObjCache) {
+    impl().ObjCache = ObjCache;
+    return impl();
+  }
+
   /// Set an ExecutorProcessControl object.
   ///
   /// If the platform uses ObjectLinkingLayer by default and no
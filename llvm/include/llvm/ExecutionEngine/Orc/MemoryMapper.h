@@ -81,9 +81,15 @@ public:
 
 class InProcessMemoryMapper : public MemoryMapper {
 public:
-  InProcessMemoryMapper(size_t PageSize);
+  /// If UseHugePages is true, reservations are requested with
+  /// sys::Memory::MF_HUGE_HINT. This is most useful with large reservations,
+  /// e.g. the slabs reserved by MapperJITLinkMemoryManager, which pack many
+  /// small allocations into the same huge pages. It is only honored on Linux
+  /// (transparent huge pages) and ignored elsewhere.
+  InProcessMemoryMapper(size_t PageSize, bool UseHugePages = false);
 
-  static Expected<std::unique_ptr<InProcessMemoryMapper>> Create();
+  static Expected<std::unique_ptr<InProcessMemoryMapper>>
+  Create(bool UseHugePages = false);
 
   unsigned int getPageSize() override { return PageSize; }
 
@@ -119,8 +125,15 @@ private:
   AllocationMap Allocations;
 
   size_t PageSize;
+  bool UseHugePages;
 };
 
+/// Maps executor memory into the controller through a shared memory object.
+///
+/// Used with MapperJITLinkMemoryManager, code and data are written by JITLink
+/// directly into the shared mapping, so only the finalization requests (and
+/// any lookups or dylib loads the JIT makes) travel over the EPC transport,
+/// not the contents of each allocation.
 class SharedMemoryMapper final : public MemoryMapper {
 public:
   struct SymbolAddrs {
@@ -23,7 +23,9 @@
 
 #if LLVM_ENABLE_THREADS
 #include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <optional>
 #include <thread>
 #endif
 
@@ -112,8 +114,19 @@ public:
 
 #if LLVM_ENABLE_THREADS
 
+/// Runs each task on a new thread.
+///
+/// If MaxMaterializationThreads is set then at most that many threads will
+/// run materialization tasks at any one time. Further materialization tasks
+/// are queued and picked up by the running threads as they finish. Other
+/// tasks (e.g. lookup continuations) are never queued, since a running
+/// materializer may be blocked waiting on them.
 class DynamicThreadPoolTaskDispatcher : public TaskDispatcher {
 public:
+  DynamicThreadPoolTaskDispatcher(
+      std::optional<size_t> MaxMaterializationThreads = std::nullopt)
+      : MaxMaterializationThreads(MaxMaterializationThreads) {}
+
   void dispatch(std::unique_ptr<Task> T) override;
   void shutdown() override;
 private:
@@ -121,6 +134,10 @@ private:
   bool Running = true;
   size_t Outstanding = 0;
   std::condition_variable OutstandingCV;
+
+  std::optional<size_t> MaxMaterializationThreads;
+  size_t NumMaterializationThreads = 0;
+  std::deque<std::unique_ptr<Task>> MaterializationTaskQueue;
 };
 
 #endif // LLVM_ENABLE_THREADS
@@ -1298,6 +1298,13 @@ public:
   /// }
   /// \endcode
   ///
+  /// This is the host lowering only. For GPU targets, clang still emits
+  /// reductions in CGOpenMPRuntimeGPU, through
+  /// __kmpc_nvptx_parallel_reduce_nowait_v2 and
+  /// __kmpc_nvptx_teams_reduce_nowait_v2 with generated shuffle-and-reduce
+  /// and inter-warp copy functions. That scheme would have to move here
+  /// before flang could get device reductions from this builder.
+  ///
   /// \param Loc                The location where the reduction was
   ///                           encountered. Must be within the associate
   ///                           directive and after the last local access to the
@@ -64,6 +64,11 @@ enum {
 /// infrastructure, including the type and constant uniquing tables.
 /// LLVMContext itself provides no locking guarantees, so you should be careful
 /// to have one context per thread.
+///
+/// Making only the uniquing tables concurrent would not lift this restriction:
+/// use lists of constants and metadata, value handles, and the many per-value
+/// side tables in LLVMContextImpl are mutated by ordinary IR edits in any
+/// module that lives in the context.
 class LLVMContext {
 public:
   LLVMContextImpl *const pImpl;
@@ -1190,6 +1190,11 @@ using ModuleAnalysisManagerFunctionProxy =
 /// Note that although function passes can access module analyses, module
 /// analyses are not invalidated while the function passes are running, so they
 /// may be stale.  Function analyses will not be stale.
+///
+/// Functions are visited one at a time. Running them concurrently would need
+/// every pass to honor the rules above, and the analysis managers and the
+/// LLVMContext (which owns the constants whose use lists passes update) to be
+/// thread-safe; none of these hold today.
 class ModuleToFunctionPassAdaptor
     : public PassInfoMixin<ModuleToFunctionPassAdaptor> {
 public:
@@ -23,6 +23,14 @@ class Module;
 
 using IRHash = uint64_t;
 
+// These hashes are intentionally lossy: even with DetailedHash set, many
+// operand kinds (globals other than functions, metadata, attributes, most
+// constants) are not hashed. Two functions with the same hash may therefore
+// differ semantically, so the hash can only be used to rule out equality, never
+// to prove it. In particular it is not a sound key for reusing analysis or
+// optimization results across modules; those results also refer to the IR they
+// were computed on and cannot outlive it.
+
 /// Returns a hash of the function \p F.
 /// \param F The function to hash.
 /// \param DetailedHash Whether or not to encode additional information in the
@@ -196,9 +196,9 @@ private:
   bool fragmentNeedsRelaxation(const MCRelaxableFragment *IF,
                                const MCAsmLayout &Layout) const;
 
-  /// Perform one layout iteration and return true if any offsets
-  /// were adjusted.
-  bool layoutOnce(MCAsmLayout &Layout);
+  /// Perform one layout iteration over \p RelaxableSections and return true if
+  /// any offsets were adjusted.
+  bool layoutOnce(MCAsmLayout &Layout, ArrayRef<MCSection *> RelaxableSections);
 
   /// Perform one layout iteration of the given section and return true
   /// if any offsets were adjusted.
@@ -129,6 +129,12 @@ private:
   /// objects.
   BumpPtrAllocator Allocator;
 
+  /// Allocator for MCFragments. Fragments are only destroyed together with
+  /// their section, so their storage is released all at once in reset()
+  /// rather than one heap allocation at a time. This must be declared before
+  /// the section allocators so it outlives the sections' fragment lists.
+  BumpPtrAllocator FragmentAllocator;
+
   SpecificBumpPtrAllocator<MCSectionCOFF> COFFAllocator;
   SpecificBumpPtrAllocator<MCSectionDXContainer> DXCAllocator;
   SpecificBumpPtrAllocator<MCSectionELF> ELFAllocator;
@@ -848,6 +854,14 @@ public:
 
   void deallocate(void *Ptr) {}
 
+  /// Create a fragment of type \p F in this context. Fragments must be
+  /// released with MCFragment::destroy(), which runs the destructor but leaves
+  /// the storage to the context.
+  template <typename F, typename... Args> F *allocFragment(Args &&...args) {
+    return new (FragmentAllocator.Allocate(sizeof(F), alignof(F)))
+        F(std::forward<Args>(args)...);
+  }
+
   bool hadError() { return HadError; }
   void diagnose(const SMDiagnostic &SMD);
   void reportError(SMLoc L, const Twine &Msg);
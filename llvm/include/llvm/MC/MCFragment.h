@@ -88,7 +88,9 @@ public:
   /// Destroys the current fragment.
   ///
   /// This must be used instead of delete as MCFragment is non-virtual.
-  /// This method will dispatch to the appropriate subclass.
+  /// This method will dispatch to the appropriate subclass. The storage is
+  /// owned by the MCContext that allocated the fragment (see
+  /// MCContext::allocFragment) and is not freed here.
   void destroy();
 
   FragmentType getKind() const { return Kind; }
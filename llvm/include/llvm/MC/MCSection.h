@@ -188,7 +188,10 @@ public:
   iterator end() { return Fragments.end(); }
   const_iterator end() const { return Fragments.end(); }
 
-  MCSection::iterator getSubsectionInsertionPoint(unsigned Subsection);
+  /// Return the insertion point for \p Subsection, creating its first
+  /// fragment in \p Ctx if it does not exist yet.
+  MCSection::iterator getSubsectionInsertionPoint(MCContext &Ctx,
+                                                  unsigned Subsection);
 
   void dump() const;
 
@@ -215,8 +218,8 @@ public:
 			  unsigned Subsection = 0);
 
   /// Associate all pending labels with empty data fragments. One fragment
-  /// will be created for each subsection as necessary.
-  void flushPendingLabels();
+  /// will be created in \p Ctx for each subsection as necessary.
+  void flushPendingLabels(MCContext &Ctx);
 };
 
 } // end namespace llvm
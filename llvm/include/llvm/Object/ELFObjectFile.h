@@ -597,8 +597,10 @@ ELFObjectFile<ELFT>::getSymbolAddress(DataRefImpl Symb) const {
     return SymTabOrErr.takeError();
 
   if (EF.getHeader().e_type == ELF::ET_REL) {
+    // The extended section index table is only consulted for SHN_XINDEX
+    // symbols, so avoid re-validating it for every other symbol.
     ArrayRef<Elf_Word> ShndxTable;
-    if (DotSymtabShndxSec) {
+    if (DotSymtabShndxSec && (*SymOrErr)->st_shndx == ELF::SHN_XINDEX) {
       // TODO: Test this error.
       if (Expected<ArrayRef<Elf_Word>> ShndxTableOrErr =
               EF.getSHNDXTable(*DotSymtabShndxSec))
@@ -806,7 +808,7 @@ Expected<section_iterator>
 ELFObjectFile<ELFT>::getSymbolSection(const Elf_Sym *ESym,
                                       const Elf_Shdr *SymTab) const {
   ArrayRef<Elf_Word> ShndxTable;
-  if (DotSymtabShndxSec) {
+  if (DotSymtabShndxSec && ESym->st_shndx == ELF::SHN_XINDEX) {
     // TODO: Test this error.
     Expected<ArrayRef<Elf_Word>> ShndxTableOrErr =
         EF.getSHNDXTable(*DotSymtabShndxSec);
@@ -26,6 +26,7 @@
 #include "llvm/Support/TimeProfiler.h"
 #include "llvm/Transforms/IPO/SampleProfileProbe.h"
 
+#include <chrono>
 #include <string>
 #include <utility>
 
@@ -469,6 +470,45 @@ private:
   void runAfterPass();
 };
 
+/// Implements -pass-function-cost-report=N: times every function pass run and
+/// prints the N slowest (pass, function) pairs, with the function's
+/// instruction count before and after the pass, when destroyed. This points at
+/// the single function that makes a pass blow up, which -time-passes hides.
+class PassFunctionCostReporter {
+public:
+  PassFunctionCostReporter() = default;
+  PassFunctionCostReporter(const PassFunctionCostReporter &) = delete;
+  void operator=(const PassFunctionCostReporter &) = delete;
+  ~PassFunctionCostReporter();
+
+  void registerCallbacks(PassInstrumentationCallbacks &PIC);
+
+private:
+  struct Entry {
+    double Seconds;
+    std::string Pass;
+    std::string Function;
+    unsigned InstsBefore;
+    unsigned InstsAfter;
+    bool operator>(const Entry &O) const { return Seconds > O.Seconds; }
+  };
+  struct Running {
+    const Function *F;
+    bool IsLoop; // The function outlives the loop even if it's invalidated.
+    std::chrono::steady_clock::time_point Start;
+    unsigned InstsBefore;
+  };
+
+  void runBeforePass(StringRef PassID, Any IR);
+  void runAfterPass(StringRef PassID, bool Invalidated);
+
+  // Passes nest (e.g. a loop pass inside a function pipeline), so this is a
+  // stack. Non-function IR units are pushed with a null function.
+  SmallVector<Running, 4> Stack;
+  // Min-heap on Seconds of the slowest entries seen so far.
+  std::vector<Entry> Slowest;
+};
+
 // Class that holds transitions between basic blocks.  The transitions
 // are contained in a map of values to names of basic blocks.
 class DCData {
@@ -570,6 +610,7 @@ class StandardInstrumentations {
   PrintPassInstrumentation PrintPass;
   TimePassesHandler TimePasses;
   TimeProfilingPassesHandler TimeProfilingPasses;
+  PassFunctionCostReporter PassFunctionCosts;
   OptNoneInstrumentation OptNone;
   OptPassGateInstrumentation OptPassGate;
   PreservedCFGCheckerInstrumentation PreservedCFGChecker;
@@ -736,6 +736,10 @@ public:
   /// functions, MismatchedFuncSum returns the maximum. If \c FuncName is not
   /// found, try to lookup \c DeprecatedFuncName to handle profiles built by
   /// older compilers.
+  ///
+  /// The lookup goes through the on-disk hash table in the (usually memory
+  /// mapped) profile buffer, so only the records stored under \c FuncName are
+  /// decoded; the cost is independent of the size of the profile.
   Expected<InstrProfRecord>
   getInstrProfRecord(StringRef FuncName, uint64_t FuncHash,
                      StringRef DeprecatedFuncName = "",
@@ -54,7 +54,10 @@ void printBumpPtrAllocatorStats(unsigned NumSlabs, size_t BytesAllocated,
 ///
 /// The BumpPtrAllocatorImpl template defaults to using a MallocAllocator
 /// object, which wraps malloc, to allocate memory, but it can be changed to
-/// use a custom allocator.
+/// use a custom allocator. Large, long-lived arenas are the place to do so:
+/// an AllocatorT returning huge-page backed memory, together with a SlabSize
+/// of the huge page size, keeps the arena's TLB footprint small without
+/// changing any of its users.
 ///
 /// The GrowthDelay specifies after how many allocated slabs the allocator
 /// increases the size of the slabs.
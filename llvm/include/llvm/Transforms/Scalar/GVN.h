@@ -255,6 +255,10 @@ private:
   // of BlockRPONumber prior to accessing the contents of BlockRPONumber.
   bool InvalidBlockRPONumbers = true;
 
+  // Non-local load dependency queries issued so far in the current function,
+  // checked against -gvn-max-nonlocal-load-queries.
+  unsigned NumNonLocalLoadQueries = 0;
+
   using LoadDepVect = SmallVector<NonLocalDepResult, 64>;
   using AvailValInBlkVect = SmallVector<gvn::AvailableValueInBlock, 64>;
   using UnavailBlkVect = SmallVector<BasicBlock *, 64>;
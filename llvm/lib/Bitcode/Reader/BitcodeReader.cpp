@@ -7002,7 +7002,15 @@ ModuleSummaryIndexBitcodeReader::makeCallList(ArrayRef<uint64_t> Record,
                                               bool IsOldProfileFormat,
                                               bool HasProfile, bool HasRelBF) {
   std::vector<FunctionSummary::EdgeTy> Ret;
-  Ret.reserve(Record.size());
+  // Each edge takes one record for the callee plus any profile fields. Size
+  // the list exactly: the summaries keep these vectors for the whole thin
+  // link, so any slack is multiplied across every function in the program.
+  unsigned FieldsPerEdge = 1;
+  if (IsOldProfileFormat)
+    FieldsPerEdge += 1 + HasProfile;
+  else if (HasProfile || HasRelBF)
+    FieldsPerEdge += 1;
+  Ret.reserve(Record.size() / FieldsPerEdge);
   for (unsigned I = 0, E = Record.size(); I != E; ++I) {
     CalleeInfo::HotnessType Hotness = CalleeInfo::HotnessType::Unknown;
     uint64_t RelBF = 0;
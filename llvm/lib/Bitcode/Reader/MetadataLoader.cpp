@@ -1106,6 +1106,10 @@ Error MetadataLoader::MetadataLoaderImpl::parseMetadata(bool ModuleLevel) {
 
   // We lazy-load module-level metadata: we build an index for each record, and
   // then load individual record as needed, starting with the named metadata.
+  // This is only done when importing (ThinLTO): a full module load ends up
+  // materializing nearly all metadata anyway, and decoding records in
+  // parallel is not possible because they are uniqued in the shared
+  // LLVMContext as they are read.
   if (ModuleLevel && IsImporting && MetadataList.empty() &&
       !DisableLazyLoading) {
     auto SuccessOrErr = lazyLoadModuleMetadataBlock();
@@ -4710,7 +4710,10 @@ void ModuleBitcodeWriter::write() {
   writeOperandBundleTags();
   writeSyncScopeNames();
 
-  // Emit function bodies.
+  // Emit function bodies. This is inherently sequential: each block is written
+  // at the current bit position of one stream, and the ValueEnumerator's
+  // function-local numbering (incorporateFunction/purgeFunction) is shared
+  // state, so blocks cannot be produced independently and stay bit-identical.
   DenseMap<const Function *, uint64_t> FunctionToBitcodeIndex;
   for (const Function &F : M)
     if (!F.isDeclaration())
@@ -3487,6 +3487,9 @@ void DwarfDebug::addDwarfTypeUnitType(DwarfCompileUnit &CU,
             : Asm->getObjFileLowering().getDwarfInfoDWOSection();
     NewTU.setSection(Section);
   } else {
+    // Each type unit gets its own COMDAT section keyed by its signature, which
+    // is a hash of the type's ODR identifier, so the linker keeps a single
+    // copy of every type across all objects without understanding DWARF.
     MCSection *Section =
         getDwarfVersion() <= 4
             ? Asm->getObjFileLowering().getDwarfTypesSection(Signature)
@@ -59,7 +59,11 @@ void DwarfFile::computeSizeAndOffsets() {
   uint64_t SecOffset = 0;
 
   // Iterate over each compile unit and set the size and offsets for each
-  // DIE within each compile unit. All offsets are CU relative.
+  // DIE within each compile unit. All offsets are CU relative. This walk is
+  // inherently sequential: a DIE's offset is the sum of the sizes of all DIEs
+  // before it, sizes depend on the forms chosen for references to other DIEs,
+  // and abbreviation numbers are handed out in visitation order, which keeps
+  // the output deterministic.
   for (const auto &TheU : CUs) {
     if (TheU->getCUNode()->isDebugDirectivesOnly())
       continue;
@@ -24,9 +24,11 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/Analysis/BranchProbabilityInfo.h"
 #include "llvm/Analysis/EHUtils.h"
+#include "llvm/Analysis/OptimizationRemarkEmitter.h"
 #include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/CodeGen/BasicBlockSectionUtils.h"
 #include "llvm/CodeGen/MachineBasicBlock.h"
@@ -34,6 +36,7 @@
 #include "llvm/CodeGen/MachineFunction.h"
 #include "llvm/CodeGen/MachineFunctionPass.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/CodeGen/MachineOptimizationRemarkEmitter.h"
 #include "llvm/CodeGen/Passes.h"
 #include "llvm/CodeGen/TargetInstrInfo.h"
 #include "llvm/IR/Function.h"
@@ -43,6 +46,12 @@
 
 using namespace llvm;
 
+#define DEBUG_TYPE "machine-function-splitter"
+
+STATISTIC(NumColdBlocks, "Number of blocks split to the cold section");
+STATISTIC(NumColdInstrs, "Number of instructions split to the cold section");
+STATISTIC(NumHotInstrs, "Number of instructions kept in split functions");
+
 // FIXME: This cutoff value is CPU dependent and should be moved to
 // TargetTransformInfo once we consider enabling this on other platforms.
 // The value is expressed as a ProfileSummaryInfo integer percentile cutoff.
@@ -62,6 +71,17 @@ static cl::opt<unsigned> ColdCountThreshold(
         "Minimum number of times a block must be executed to be retained."),
     cl::init(1), cl::Hidden);
 
+// Sample profiles rarely report a count of exactly zero for blocks that are
+// almost never executed, so a fixed count threshold leaves such blocks in the
+// hot section. This treats a block as cold when it runs less often than the
+// given fraction of the function's entry count.
+static cl::opt<unsigned> SampleEntryCountPermille(
+    "mfs-sample-entry-count-permille",
+    cl::desc("With sample profiles, also split blocks whose count is below "
+             "this many thousandths of the function entry count. Unused if "
+             "set to zero."),
+    cl::init(0), cl::Hidden);
+
 static cl::opt<bool> SplitAllEHCode(
     "mfs-split-ehcode",
     cl::desc("Splits all EH code and it's descendants by default."),
@@ -107,7 +127,7 @@ static void finishAdjustingBasicBlocksAndLandingPads(MachineFunction &MF) {
 
 static bool isColdBlock(const MachineBasicBlock &MBB,
                         const MachineBlockFrequencyInfo *MBFI,
-                        ProfileSummaryInfo *PSI) {
+                        ProfileSummaryInfo *PSI, uint64_t ColdThreshold) {
   std::optional<uint64_t> Count = MBFI->getBlockProfileCount(&MBB);
 
   // Temporary hack to cope with AArch64's jump table encoding
@@ -131,7 +151,53 @@ static bool isColdBlock(const MachineBasicBlock &MBB,
       return false;
   }
 
-  return (*Count < ColdCountThreshold);
+  return (*Count < ColdThreshold);
+}
+
+/// Returns the count below which a block is considered cold in \p MF.
+static uint64_t getColdThreshold(const MachineFunction &MF,
+                                 const MachineBlockFrequencyInfo *MBFI,
+                                 ProfileSummaryInfo *PSI) {
+  uint64_t Threshold = ColdCountThreshold;
+  if (!SampleEntryCountPermille || !PSI->hasSampleProfile())
+    return Threshold;
+  if (std::optional<uint64_t> EntryCount =
+          MBFI->getBlockProfileCount(&MF.front()))
+    Threshold = std::max<uint64_t>(
+        Threshold, *EntryCount / 1000 * SampleEntryCountPermille +
+                       *EntryCount % 1000 * SampleEntryCountPermille / 1000);
+  return Threshold;
+}
+
+/// Updates the split statistics and reports how much of \p MF ended up in the
+/// cold section, so that the cutoffs can be tuned.
+static void reportSplit(MachineFunction &MF,
+                        MachineOptimizationRemarkEmitter *ORE) {
+  unsigned ColdBlocks = 0, ColdInstrs = 0, HotInstrs = 0;
+  for (const MachineBasicBlock &MBB : MF) {
+    bool IsCold = MBB.getSectionID() == MBBSectionID::ColdSectionID;
+    ColdBlocks += IsCold;
+    for (const MachineInstr &MI : MBB) {
+      if (MI.isMetaInstruction())
+        continue;
+      (IsCold ? ColdInstrs : HotInstrs) += 1;
+    }
+  }
+  NumColdBlocks += ColdBlocks;
+  NumColdInstrs += ColdInstrs;
+  NumHotInstrs += HotInstrs;
+
+  if (!ORE)
+    return;
+  ORE->emit([&]() {
+    return MachineOptimizationRemarkAnalysis(DEBUG_TYPE, "SplitRatio",
+                                             MF.getFunction().getSubprogram(),
+                                             &MF.front())
+           << "split " << ore::NV("ColdBlocks", ColdBlocks) << " blocks with "
+           << ore::NV("ColdInstrs", ColdInstrs)
+           << " instructions to the cold section, keeping "
+           << ore::NV("HotInstrs", HotInstrs) << " instructions hot";
+  });
 }
 
 bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
@@ -155,6 +221,9 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
 
   MachineBlockFrequencyInfo *MBFI = nullptr;
   ProfileSummaryInfo *PSI = nullptr;
+  MachineOptimizationRemarkEmitter *ORE =
+      &getAnalysis<MachineOptimizationRemarkEmitterPass>().getORE();
+  uint64_t ColdThreshold = ColdCountThreshold;
   if (UseProfileData) {
     MBFI = &getAnalysis<MachineBlockFrequencyInfo>();
     PSI = &getAnalysis<ProfileSummaryInfoWrapperPass>().getPSI();
@@ -167,8 +236,10 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
       if (SplitAllEHCode)
         setDescendantEHBlocksCold(MF);
       finishAdjustingBasicBlocksAndLandingPads(MF);
+      reportSplit(MF, ORE);
       return true;
     }
+    ColdThreshold = getColdThreshold(MF, MBFI, PSI);
   }
 
   SmallVector<MachineBasicBlock *, 2> LandingPads;
@@ -178,7 +249,8 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
 
     if (MBB.isEHPad())
       LandingPads.push_back(&MBB);
-    else if (UseProfileData && isColdBlock(MBB, MBFI, PSI) && !SplitAllEHCode)
+    else if (UseProfileData && isColdBlock(MBB, MBFI, PSI, ColdThreshold) &&
+             !SplitAllEHCode)
       MBB.setSectionID(MBBSectionID::ColdSectionID);
   }
 
@@ -190,7 +262,7 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
     // Here we have UseProfileData == true.
     bool HasHotLandingPads = false;
     for (const MachineBasicBlock *LP : LandingPads) {
-      if (!isColdBlock(*LP, MBFI, PSI))
+      if (!isColdBlock(*LP, MBFI, PSI, ColdThreshold))
         HasHotLandingPads = true;
     }
     if (!HasHotLandingPads) {
@@ -200,6 +272,7 @@ bool MachineFunctionSplitter::runOnMachineFunction(MachineFunction &MF) {
   }
 
   finishAdjustingBasicBlocksAndLandingPads(MF);
+  reportSplit(MF, ORE);
   return true;
 }
 
@@ -207,6 +280,7 @@ void MachineFunctionSplitter::getAnalysisUsage(AnalysisUsage &AU) const {
   AU.addRequired<MachineModuleInfoWrapperPass>();
   AU.addRequired<MachineBlockFrequencyInfo>();
   AU.addRequired<ProfileSummaryInfoWrapperPass>();
+  AU.addRequired<MachineOptimizationRemarkEmitterPass>();
 }
 
 char MachineFunctionSplitter::ID = 0;
@@ -75,6 +75,7 @@
 #include "llvm/Support/SuffixTree.h"
 #include "llvm/Support/raw_ostream.h"
 #include <functional>
+#include <set>
 #include <tuple>
 #include <vector>
 
@@ -581,11 +582,13 @@ void MachineOutliner::findCandidates(
   // First, find all of the repeated substrings in the tree of minimum length
   // 2.
   std::vector<Candidate> CandidatesForRepeatedSeq;
+  std::set<unsigned> KeptStartIndices;
   LLVM_DEBUG(dbgs() << "*** Discarding overlapping candidates *** \n");
   LLVM_DEBUG(
       dbgs() << "Searching for overlaps in all repeated sequences...\n");
   for (const SuffixTree::RepeatedSubstring &RS : ST) {
     CandidatesForRepeatedSeq.clear();
+    KeptStartIndices.clear();
     unsigned StringLen = RS.Length;
     LLVM_DEBUG(dbgs() << "  Sequence length: " << StringLen << "\n");
     // Debug code to keep track of how many candidates we removed.
@@ -615,18 +618,22 @@ void MachineOutliner::findCandidates(
       // That is, one must either
       // * End before the other starts
       // * Start after the other ends
+      //
+      // Every occurrence has the same length, so a kept candidate overlaps this
+      // one iff it starts in [StartIdx - (StringLen - 1), EndIdx]. Looking that
+      // up in the ordered set of kept start indices avoids comparing against
+      // every kept candidate, while keeping the same candidates in the same
+      // order as a linear scan would.
       unsigned EndIdx = StartIdx + StringLen - 1;
-      auto FirstOverlap = find_if(
-          CandidatesForRepeatedSeq, [StartIdx, EndIdx](const Candidate &C) {
-            return EndIdx >= C.getStartIdx() && StartIdx <= C.getEndIdx();
-          });
-      if (FirstOverlap != CandidatesForRepeatedSeq.end()) {
+      auto FirstOverlap = KeptStartIndices.lower_bound(
+          StartIdx >= StringLen - 1 ? StartIdx - (StringLen - 1) : 0);
+      if (FirstOverlap != KeptStartIndices.end() && *FirstOverlap <= EndIdx) {
 #ifndef NDEBUG
         ++NumDiscarded;
         LLVM_DEBUG(dbgs() << "    .. DISCARD candidate @ [" << StartIdx
                           << ", " << EndIdx << "]; overlaps with candidate @ ["
-                          << FirstOverlap->getStartIdx() << ", "
-                          << FirstOverlap->getEndIdx() << "]\n");
+                          << *FirstOverlap << ", "
+                          << *FirstOverlap + StringLen - 1 << "]\n");
 #endif
         continue;
       }
@@ -639,6 +646,7 @@ void MachineOutliner::findCandidates(
       MachineBasicBlock::iterator StartIt = Mapper.InstrList[StartIdx];
       MachineBasicBlock::iterator EndIt = Mapper.InstrList[EndIdx];
       MachineBasicBlock *MBB = StartIt->getParent();
+      KeptStartIndices.insert(StartIdx);
       CandidatesForRepeatedSeq.emplace_back(StartIdx, StringLen, StartIt, EndIt,
                                             MBB, FunctionList.size(),
                                             Mapper.MBBFlagsMap[MBB]);
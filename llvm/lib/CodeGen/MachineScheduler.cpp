@@ -74,6 +74,8 @@ using namespace llvm;
 #define DEBUG_TYPE "machine-scheduler"
 
 STATISTIC(NumClustered, "Number of load/store pairs clustered");
+STATISTIC(NumRegionsCapped,
+          "Number of scheduling regions cut at -misched-max-region-instrs");
 
 namespace llvm {
 
@@ -132,6 +134,16 @@ static cl::opt<unsigned> SchedOnlyBlock("misched-only-block", cl::Hidden,
 static cl::opt<unsigned> ReadyListLimit("misched-limit", cl::Hidden,
   cl::desc("Limit ready list to N instructions"), cl::init(256));
 
+/// Building the dependence graph is superlinear in the number of memory
+/// operations of a region, so huge unrolled blocks can dominate compile time.
+/// Cutting them into bounded windows trades some scheduling freedom across the
+/// cut for predictable cost.
+static cl::opt<unsigned> MaxRegionInstrs(
+    "misched-max-region-instrs", cl::Hidden,
+    cl::desc("Split scheduling regions after N instructions; the instruction "
+             "at each cut is not moved (0 = no limit)"),
+    cl::init(0));
+
 static cl::opt<bool> EnableRegPressure("misched-regpressure", cl::Hidden,
   cl::desc("Enable register pressure scheduling."), cl::init(true));
 
@@ -542,6 +554,12 @@ getSchedRegions(MachineBasicBlock *MBB,
       MachineInstr &MI = *std::prev(I);
       if (isSchedBoundary(&MI, &*MBB, MF, TII))
         break;
+      // Cut the region here; MI becomes the end boundary of the next one.
+      if (MaxRegionInstrs && NumRegionInstrs >= MaxRegionInstrs &&
+          !MI.isDebugOrPseudoInstr()) {
+        ++NumRegionsCapped;
+        break;
+      }
       if (!MI.isDebugOrPseudoInstr()) {
         // MBB::size() uses instr_iterator to count. Here we need a bundle to
         // count as a single instruction.
@@ -82,6 +82,8 @@ using namespace llvm;
 STATISTIC(NumGlobalSplits, "Number of split global live ranges");
 STATISTIC(NumLocalSplits,  "Number of split local live ranges");
 STATISTIC(NumEvicted,      "Number of interferences evicted");
+STATISTIC(NumRegionSplitBudgetExceeded,
+          "Number of functions that exhausted the region split budget");
 
 static cl::opt<SplitEditor::ComplementSpillMode> SplitSpillMode(
     "split-spill-mode", cl::Hidden,
@@ -128,6 +130,12 @@ static cl::opt<unsigned long> GrowRegionComplexityBudget(
              "limit its budget and bail out once we reach the limit."),
     cl::init(10000), cl::Hidden);
 
+static cl::opt<unsigned> RegionSplitBudget(
+    "greedy-region-split-budget",
+    cl::desc("Maximum number of region splits attempted per function before "
+             "global live ranges fall back to block splitting (0 = no limit)"),
+    cl::init(0), cl::Hidden);
+
 static cl::opt<bool> GreedyRegClassPriorityTrumpsGlobalness(
     "greedy-regclass-priority-trumps-globalness",
     cl::desc("Change the greedy register allocator's live range priority "
@@ -1805,8 +1813,10 @@ unsigned RAGreedy::trySplit(const LiveInterval &VirtReg, AllocationOrder &Order,
 
   // First try to split around a region spanning multiple blocks. RS_Split2
   // ranges already made dubious progress with region splitting, so they go
-  // straight to single block splitting.
-  if (ExtraInfo->getStage(VirtReg) < RS_Split2) {
+  // straight to single block splitting. So does everything once the function
+  // has used up its region split budget.
+  if (ExtraInfo->getStage(VirtReg) < RS_Split2 &&
+      !exceededRegionSplitBudget()) {
     MCRegister PhysReg = tryRegionSplit(VirtReg, Order, NewVRegs);
     if (PhysReg || !NewVRegs.empty())
       return PhysReg;
@@ -1816,6 +1826,30 @@ unsigned RAGreedy::trySplit(const LiveInterval &VirtReg, AllocationOrder &Order,
   return tryBlockSplit(VirtReg, Order, NewVRegs);
 }
 
+/// Count a region split attempt and return true if the function is over
+/// budget. Region splitting scales with the number of edge bundles a range
+/// crosses, so huge functions can spend most of their allocation time there.
+bool RAGreedy::exceededRegionSplitBudget() {
+  if (!RegionSplitBudget)
+    return false;
+  if (NumRegionSplitAttempts < RegionSplitBudget) {
+    ++NumRegionSplitAttempts;
+    return false;
+  }
+  if (NumRegionSplitAttempts++ == RegionSplitBudget) {
+    ++NumRegionSplitBudgetExceeded;
+    ORE->emit([&]() {
+      return MachineOptimizationRemarkMissed(DEBUG_TYPE, "RegionSplitBudget",
+                                             MF->getFunction().getSubprogram(),
+                                             &MF->front())
+             << "region split budget of "
+             << ore::NV("Budget", RegionSplitBudget.getValue())
+             << " exhausted; falling back to block splitting";
+    });
+  }
+  return true;
+}
+
 //===----------------------------------------------------------------------===//
 //                          Last Chance Recoloring
 //===----------------------------------------------------------------------===//
@@ -2750,6 +2784,7 @@ bool RAGreedy::runOnMachineFunction(MachineFunction &mf) {
   IntfCache.init(MF, Matrix->getLiveUnions(), Indexes, LIS, TRI);
   GlobalCand.resize(32);  // This will grow as needed.
   SetOfBrokenHints.clear();
+  NumRegionSplitAttempts = 0;
 
   allocatePhysRegs();
   tryHintsRecoloring();
@@ -282,6 +282,10 @@ private:
 
   bool ReverseLocalAssignment = false;
 
+  /// Number of region splits attempted in the current function, checked
+  /// against -greedy-region-split-budget.
+  unsigned NumRegionSplitAttempts = 0;
+
 public:
   RAGreedy(const RegClassFilterFunc F = allocateAllRegClasses);
 
@@ -329,6 +333,7 @@ private:
   bool addSplitConstraints(InterferenceCache::Cursor, BlockFrequency &);
   bool addThroughConstraints(InterferenceCache::Cursor, ArrayRef<unsigned>);
   bool growRegion(GlobalSplitCandidate &Cand);
+  bool exceededRegionSplitBudget();
   BlockFrequency calcGlobalSplitCost(GlobalSplitCandidate &,
                                      const AllocationOrder &Order);
   bool calcCompactRegion(GlobalSplitCandidate &);
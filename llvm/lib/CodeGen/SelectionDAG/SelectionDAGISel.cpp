@@ -1509,7 +1509,12 @@ void SelectionDAGISel::SelectAllBasicBlocks(const Function &Fn) {
     processDbgDeclares(*FuncInfo);
   }
 
-  // Iterate over all basic blocks in the function.
+  // Iterate over all basic blocks in the function. The blocks are selected
+  // one at a time, in RPO, and this order is load-bearing: the PHI live-out
+  // info computed above, FuncInfo's value-to-vreg map, the StaticAllocaMap and
+  // the MachineFunction's register and constant pool tables are all updated as
+  // each block is lowered, and CurDAG is reused between blocks. Selecting
+  // blocks concurrently would need all of that state split per block first.
   StackProtector &SP = getAnalysis<StackProtector>();
   for (const BasicBlock *LLVMBB : RPOT) {
     if (OptLevel != CodeGenOptLevel::None) {
@@ -75,7 +75,13 @@ public:
 
   /// Do not unique types according to ODR.
   void setNoODR(bool) override {
-    // FIXME: set option when ODR mode will be supported.
+    // FIXME: set option when ODR mode will be supported. Until then types
+    // are cloned into every compile unit that references them, so output is
+    // noticeably larger than the classic linker's. Supporting ODR requires
+    // the artificial type unit described in DWARFLinker.h: a concurrent pool
+    // of types keyed by their (synthetic) qualified names, filled during
+    // liveness analysis, merging partial definitions and patching references
+    // from every compile unit to the pooled DIEs.
     // getOptions().NoODR = NoODR;
     GlobalData.Options.NoODR = true;
   }
@@ -13,12 +13,14 @@
 #include "llvm/DWP/DWP.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/DWP/DWPError.h"
+#include "llvm/MC/MCAsmInfo.h"
 #include "llvm/MC/MCContext.h"
 #include "llvm/MC/MCObjectFileInfo.h"
 #include "llvm/MC/MCTargetOptionsCommandFlags.h"
 #include "llvm/Object/Decompressor.h"
 #include "llvm/Object/ELFObjectFile.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include <limits>
 
@@ -430,11 +432,20 @@ void writeStringsAndOffsets(MCStreamer &Out, DWPStringPool &Strings,
   assert(HeaderSize <= Size && "StrOffsetSection size is less than its header");
   // Copy the header to the output.
   Out.emitBytes(Data.getBytes(&Offset, HeaderSize));
+  // Remap the offsets into a local buffer and emit them with a single call;
+  // there is one entry per string, so per-entry emission dominates otherwise.
+  SmallString<0> NewOffsets;
+  NewOffsets.reserve(Size - Offset);
+  raw_svector_ostream OS(NewOffsets);
+  support::endian::Writer W(OS, Out.getContext().getAsmInfo()->isLittleEndian()
+                                    ? llvm::endianness::little
+                                    : llvm::endianness::big);
   while (Offset < Size) {
     auto OldOffset = Data.getU32(&Offset);
     auto NewOffset = OffsetRemapping[OldOffset];
-    Out.emitIntValue(NewOffset, 4);
+    W.write<uint32_t>(NewOffset);
   }
+  Out.emitBytes(NewOffsets);
 }
 
 enum AccessField { Offset, Length };
@@ -84,6 +84,32 @@ SymbolizableObjectFile::create(const object::ObjectFile *Obj,
   }
   SS.erase(J, SS.end());
 
+  // Collect the text sections once so that queries without a section index
+  // do not have to walk the whole section table. If the sections do not
+  // overlap (the usual case for linked images), keep them sorted by address
+  // for binary search; otherwise keep section order so that the first match
+  // wins, as before.
+  std::vector<TextSectionDesc> &TS = res->TextSections;
+  for (SectionRef Sec : Obj->sections()) {
+    if (!Sec.isText() || Sec.isVirtual() || Sec.getSize() == 0)
+      continue;
+    TS.push_back({Sec.getAddress(), Sec.getSize(), Sec.getIndex()});
+  }
+  std::vector<TextSectionDesc> Sorted(TS);
+  llvm::stable_sort(Sorted, [](const TextSectionDesc &L,
+                               const TextSectionDesc &R) {
+    return L.Addr < R.Addr;
+  });
+  res->TextSectionsSorted = true;
+  for (size_t Idx = 1, N = Sorted.size(); Idx < N; ++Idx) {
+    if (Sorted[Idx].Addr - Sorted[Idx - 1].Addr < Sorted[Idx - 1].Size) {
+      res->TextSectionsSorted = false;
+      break;
+    }
+  }
+  if (res->TextSectionsSorted)
+    TS = std::move(Sorted);
+
   return std::move(res);
 }
 
@@ -367,15 +393,23 @@ SymbolizableObjectFile::findSymbol(StringRef Symbol) const {
 /// Search for the first occurence of specified Address in ObjectFile.
 uint64_t SymbolizableObjectFile::getModuleSectionIndexForAddress(
     uint64_t Address) const {
-
-  for (SectionRef Sec : Module->sections()) {
-    if (!Sec.isText() || Sec.isVirtual())
-      continue;
-
-    if (Address >= Sec.getAddress() &&
-        Address < Sec.getAddress() + Sec.getSize())
-      return Sec.getIndex();
+  auto Contains = [Address](const TextSectionDesc &Sec) {
+    return Address >= Sec.Addr && Address - Sec.Addr < Sec.Size;
+  };
+
+  if (TextSectionsSorted) {
+    auto It = llvm::upper_bound(TextSections, Address,
+                                [](uint64_t A, const TextSectionDesc &Sec) {
+                                  return A < Sec.Addr;
+                                });
+    if (It != TextSections.begin() && Contains(*std::prev(It)))
+      return std::prev(It)->Index;
+    return object::SectionedAddress::UndefSection;
   }
 
+  for (const TextSectionDesc &Sec : TextSections)
+    if (Contains(Sec))
+      return Sec.Index;
+
   return object::SectionedAddress::UndefSection;
 }
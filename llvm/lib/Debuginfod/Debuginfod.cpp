@@ -122,6 +122,24 @@ Expected<std::string> getCachedOrDownloadDebuginfo(BuildIDRef ID) {
   return getCachedOrDownloadArtifact(uniqueKey(UrlPath), UrlPath);
 }
 
+std::vector<std::string> prefetchDebuginfo(ArrayRef<BuildIDRef> IDs,
+                                           ThreadPoolStrategy S) {
+  std::vector<std::string> Paths(IDs.size());
+  // Each fetch uses its own HTTPClient and cache stream, so fetches for
+  // distinct build IDs are independent.
+  ThreadPool Pool(S);
+  for (size_t I = 0, E = IDs.size(); I != E; ++I)
+    Pool.async([&, I]() {
+      Expected<std::string> PathOrErr = getCachedOrDownloadDebuginfo(IDs[I]);
+      if (PathOrErr)
+        Paths[I] = std::move(*PathOrErr);
+      else
+        consumeError(PathOrErr.takeError());
+    });
+  Pool.wait();
+  return Paths;
+}
+
 // General fetching function.
 Expected<std::string> getCachedOrDownloadArtifact(StringRef UniqueKey,
                                                   StringRef UrlPath) {
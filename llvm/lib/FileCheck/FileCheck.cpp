@@ -1068,6 +1068,20 @@ void Pattern::AddBackrefToRegEx(unsigned BackrefNum) {
   RegExStr += Backref;
 }
 
+/// Returns literal text that every match of \p RegEx must start with, or an
+/// empty string if no such prefix is readily known.
+static StringRef getLiteralPrefix(StringRef RegEx) {
+  // An alternation anywhere could make the prefix optional.
+  if (RegEx.contains('|'))
+    return StringRef();
+  size_t Len = RegEx.find_first_of("^$()[]{}.*+?\\");
+  // A quantifier applies to the character before it.
+  if (Len != StringRef::npos && Len > 0 &&
+      StringRef("*+?{").contains(RegEx[Len]))
+    --Len;
+  return RegEx.substr(0, Len);
+}
+
 Pattern::MatchResult Pattern::match(StringRef Buffer,
                                     const SourceMgr &SM) const {
   // If this is the EOF pattern, match it immediately.
@@ -1135,11 +1149,24 @@ Pattern::MatchResult Pattern::match(StringRef Buffer,
     RegExToMatch = TmpStr;
   }
 
+  // No match can start before the first occurrence of the regex's literal
+  // prefix, so skip ahead to it with a plain string search. This is much
+  // cheaper than letting the regex engine scan large inputs.
+  StringRef SearchBuffer = Buffer;
+  StringRef Prefix = getLiteralPrefix(RegExToMatch);
+  if (!Prefix.empty()) {
+    size_t Pos =
+        IgnoreCase ? Buffer.find_insensitive(Prefix) : Buffer.find(Prefix);
+    if (Pos == StringRef::npos)
+      return make_error<NotFoundError>();
+    SearchBuffer = Buffer.substr(Pos);
+  }
+
   SmallVector<StringRef, 4> MatchInfo;
   unsigned int Flags = Regex::Newline;
   if (IgnoreCase)
     Flags |= Regex::IgnoreCase;
-  if (!Regex(RegExToMatch, Flags).match(Buffer, &MatchInfo))
+  if (!Regex(RegExToMatch, Flags).match(SearchBuffer, &MatchInfo))
     return make_error<NotFoundError>();
 
   // Successful regex match.
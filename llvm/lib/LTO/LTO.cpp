@@ -69,6 +69,11 @@ static cl::opt<bool>
     DumpThinCGSCCs("dump-thin-cg-sccs", cl::init(false), cl::Hidden,
                    cl::desc("Dump the SCCs in the ThinLTO index's callgraph"));
 
+static cl::opt<bool> EmitThinLTOCostEstimates(
+    "thinlto-emit-cost-estimates", cl::init(false), cl::Hidden,
+    cl::desc("When writing distributed ThinLTO index files, also write a "
+             "<module>.thinlto.cost file estimating the backend's work"));
+
 namespace llvm {
 /// Enable global value internalization in LTO.
 cl::opt<bool> EnableLTOInternalization(
@@ -86,6 +91,12 @@ extern cl::opt<bool> EnableMemProfContextDisambiguation;
 // Computes a unique hash for the Module considering the current list of
 // export/import and other global analysis results.
 // The hash is produced in \p Key.
+//
+// The granularity is the whole backend: the key covers the hashes of every
+// module the backend imports from, so editing a widely imported function
+// invalidates every importer. Finer keys (per function) would not be sound,
+// since the backend's output for one function depends on inlining and IPO
+// decisions made over everything imported into the module.
 void llvm::computeLTOCacheKey(
     SmallString<40> &Key, const Config &Conf, const ModuleSummaryIndex &Index,
     StringRef ModuleID, const FunctionImporter::ImportMapTy &ImportList,
@@ -1000,35 +1011,41 @@ Error LTO::linkRegularLTO(RegularLTOState::AddedModule Mod,
 Error LTO::addThinLTO(BitcodeModule BM, ArrayRef<InputFile::Symbol> Syms,
                       const SymbolResolution *&ResI,
                       const SymbolResolution *ResE) {
+  // Computing a GUID hashes the symbol's global identifier, so remember them
+  // for the second walk over the symbols below.
+  SmallVector<GlobalValue::GUID, 0> GUIDs;
+  GUIDs.reserve(Syms.size());
   const SymbolResolution *ResITmp = ResI;
   for (const InputFile::Symbol &Sym : Syms) {
     assert(ResITmp != ResE);
     SymbolResolution Res = *ResITmp++;
 
+    GlobalValue::GUID GUID = 0;
     if (!Sym.getIRName().empty()) {
-      auto GUID = GlobalValue::getGUID(GlobalValue::getGlobalIdentifier(
+      GUID = GlobalValue::getGUID(GlobalValue::getGlobalIdentifier(
           Sym.getIRName(), GlobalValue::ExternalLinkage, ""));
       if (Res.Prevailing)
         ThinLTO.PrevailingModuleForGUID[GUID] = BM.getModuleIdentifier();
     }
+    GUIDs.push_back(GUID);
   }
 
+  // Use lookup() rather than operator[] so that reading a summary does not
+  // add an empty entry for every non-prevailing GUID it mentions.
   if (Error Err =
           BM.readSummary(ThinLTO.CombinedIndex, BM.getModuleIdentifier(),
                          [&](GlobalValue::GUID GUID) {
-                           return ThinLTO.PrevailingModuleForGUID[GUID] ==
-                                  BM.getModuleIdentifier();
+                           return ThinLTO.PrevailingModuleForGUID.lookup(
+                                      GUID) == BM.getModuleIdentifier();
                          }))
     return Err;
   LLVM_DEBUG(dbgs() << "Module " << BM.getModuleIdentifier() << "\n");
 
-  for (const InputFile::Symbol &Sym : Syms) {
+  for (auto [Sym, GUID] : zip_equal(Syms, GUIDs)) {
     assert(ResI != ResE);
     SymbolResolution Res = *ResI++;
 
     if (!Sym.getIRName().empty()) {
-      auto GUID = GlobalValue::getGUID(GlobalValue::getGlobalIdentifier(
-          Sym.getIRName(), GlobalValue::ExternalLinkage, ""));
       if (Res.Prevailing) {
         assert(ThinLTO.PrevailingModuleForGUID[GUID] ==
                BM.getModuleIdentifier());
@@ -1405,6 +1422,44 @@ public:
       if (EC)
         return errorCodeToError(EC);
     }
+
+    if (EmitThinLTOCostEstimates)
+      if (Error E =
+              emitCostEstimate(ModulePath, NewModulePath + ".thinlto.cost",
+                               ModuleToSummariesForIndex))
+        return E;
+    return Error::success();
+  }
+
+  // Writes the number of functions and IR instructions the backend for
+  // ModulePath will optimize, split into the module's own definitions and
+  // those it imports. Schedulers can use this to start the largest backends
+  // first.
+  Error emitCostEstimate(
+      StringRef ModulePath, const std::string &OutputPath,
+      const std::map<std::string, GVSummaryMapTy> &ModuleToSummariesForIndex) {
+    uint64_t Functions = 0, Instructions = 0;
+    uint64_t ImportedFunctions = 0, ImportedInstructions = 0;
+    for (const auto &[Module, Summaries] : ModuleToSummariesForIndex) {
+      bool Imported = Module != ModulePath;
+      for (const auto &[GUID, Summary] : Summaries) {
+        // Aliases are skipped, since their aliasee is counted on its own.
+        auto *FS = dyn_cast<FunctionSummary>(Summary);
+        if (!FS)
+          continue;
+        (Imported ? ImportedFunctions : Functions) += 1;
+        (Imported ? ImportedInstructions : Instructions) += FS->instCount();
+      }
+    }
+
+    std::error_code EC;
+    raw_fd_ostream OS(OutputPath, EC, sys::fs::OpenFlags::OF_Text);
+    if (EC)
+      return errorCodeToError(EC);
+    OS << "functions: " << Functions << "\n"
+       << "instructions: " << Instructions << "\n"
+       << "imported-functions: " << ImportedFunctions << "\n"
+       << "imported-instructions: " << ImportedInstructions << "\n";
     return Error::success();
   }
 };
@@ -1738,7 +1793,7 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
                                LocalWPDTargetsMap);
 
   auto isPrevailing = [&](GlobalValue::GUID GUID, const GlobalValueSummary *S) {
-    return ThinLTO.PrevailingModuleForGUID[GUID] == S->modulePath();
+    return ThinLTO.PrevailingModuleForGUID.lookup(GUID) == S->modulePath();
   };
   if (EnableMemProfContextDisambiguation) {
     MemProfContextDisambiguation ContextDisambiguation;
@@ -511,6 +511,11 @@ Error lto::backend(const Config &C, AddStreamFn AddStream,
   std::unique_ptr<TargetMachine> TM = createTargetMachine(C, *TOrErr, Mod);
 
   LLVM_DEBUG(dbgs() << "Running regular LTO\n");
+  // The optimization pipeline runs on the whole merged module. Splitting it
+  // to run the function simplification passes per partition would not be
+  // equivalent: the full LTO pipeline interleaves them with inlining and
+  // other module passes, and partitions would lose the IPO information the
+  // later passes rely on. Use ThinLTO to parallelize optimization.
   if (!C.CodeGenOnly) {
     if (!opt(C, TM.get(), 0, Mod, /*IsThinLTO=*/false,
              /*ExportSummary=*/&CombinedIndex, /*ImportSummary=*/nullptr,
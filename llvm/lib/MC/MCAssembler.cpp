@@ -812,6 +812,24 @@ MCAssembler::handleFixup(const MCAsmLayout &Layout, MCFragment &F,
   return std::make_tuple(Target, FixedValue, IsResolved);
 }
 
+/// Returns true if MCAssembler::relaxFragment can change the size of \p F.
+/// Keep this in sync with the fragment kinds handled there.
+static bool mayRelax(const MCFragment &F) {
+  switch (F.getKind()) {
+  default:
+    return false;
+  case MCFragment::FT_Relaxable:
+  case MCFragment::FT_Dwarf:
+  case MCFragment::FT_DwarfFrame:
+  case MCFragment::FT_LEB:
+  case MCFragment::FT_BoundaryAlign:
+  case MCFragment::FT_CVInlineLines:
+  case MCFragment::FT_CVDefRange:
+  case MCFragment::FT_PseudoProbe:
+    return true;
+  }
+}
+
 void MCAssembler::layout(MCAsmLayout &Layout) {
   assert(getBackendPtr() && "Expected assembler backend");
   DEBUG_WITH_TYPE("mc-dump", {
@@ -824,7 +842,7 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
     // Create dummy fragments to eliminate any empty sections, this simplifies
     // layout.
     if (Sec.getFragmentList().empty())
-      new MCDataFragment(&Sec);
+      getContext().allocFragment<MCDataFragment>(&Sec);
 
     Sec.setOrdinal(SectionIndex++);
   }
@@ -839,8 +857,16 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
       Frag.setLayoutOrder(FragmentIndex++);
   }
 
+  // Only sections that contain a fragment relaxFragment can change need to be
+  // revisited on every iteration. Data-only sections (most debug info) never
+  // change size through relaxation.
+  SmallVector<MCSection *, 0> RelaxableSections;
+  for (MCSection &Sec : *this)
+    if (llvm::any_of(Sec, [](const MCFragment &F) { return mayRelax(F); }))
+      RelaxableSections.push_back(&Sec);
+
   // Layout until everything fits.
-  while (layoutOnce(Layout)) {
+  while (layoutOnce(Layout, RelaxableSections)) {
     if (getContext().hadError())
       return;
     // Size of fragments in one section can depend on the size of fragments in
@@ -1216,12 +1242,13 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
   return false;
 }
 
-bool MCAssembler::layoutOnce(MCAsmLayout &Layout) {
+bool MCAssembler::layoutOnce(MCAsmLayout &Layout,
+                             ArrayRef<MCSection *> RelaxableSections) {
   ++stats::RelaxationSteps;
 
   bool WasRelaxed = false;
-  for (MCSection &Sec : *this) {
-    while (layoutSectionOnce(Layout, Sec))
+  for (MCSection *Sec : RelaxableSections) {
+    while (layoutSectionOnce(Layout, *Sec))
       WasRelaxed = true;
   }
 
@@ -119,6 +119,10 @@ MCContext::~MCContext() {
   if (AutoReset)
     reset();
 
+  // The CodeView string table fragment lives in FragmentAllocator, which is
+  // destroyed before CVContext.
+  CVContext.reset();
+
   // NOTE: The symbols are all allocated out of a bump pointer allocator,
   // we don't need to free them here.
 }
@@ -165,6 +169,7 @@ void MCContext::reset() {
   CurrentDwarfLoc = MCDwarfLoc(0, 0, 0, DWARF2_FLAG_IS_STMT, 0, 0);
 
   CVContext.reset();
+  FragmentAllocator.Reset();
 
   MachOUniquingMap.clear();
   ELFUniquingMap.clear();
@@ -493,7 +498,7 @@ MCSectionELF *MCContext::createELFSectionImpl(StringRef Section, unsigned Type,
       MCSectionELF(Section, Type, Flags, K, EntrySize, Group, Comdat, UniqueID,
                    R, LinkedToSym);
 
-  auto *F = new MCDataFragment();
+  auto *F = allocFragment<MCDataFragment>();
   Ret->getFragmentList().insert(Ret->begin(), F);
   F->setParent(Ret);
   R->setFragment(F);
@@ -757,7 +762,7 @@ MCSectionWasm *MCContext::getWasmSection(const Twine &Section, SectionKind Kind,
       MCSectionWasm(CachedName, Kind, Flags, GroupSym, UniqueID, Begin);
   Entry.second = Result;
 
-  auto *F = new MCDataFragment();
+  auto *F = allocFragment<MCDataFragment>();
   Result->getFragmentList().insert(Result->begin(), F);
   F->setParent(Result);
   Begin->setFragment(F);
@@ -823,7 +828,7 @@ MCSectionXCOFF *MCContext::getXCOFFSection(
 
   Entry.second = Result;
 
-  auto *F = new MCDataFragment();
+  auto *F = allocFragment<MCDataFragment>();
   Result->getFragmentList().insert(Result->begin(), F);
   F->setParent(Result);
 
@@ -846,7 +851,7 @@ MCSectionSPIRV *MCContext::getSPIRVSection() {
   MCSectionSPIRV *Result = new (SPIRVAllocator.Allocate())
       MCSectionSPIRV(SectionKind::getText(), Begin);
 
-  auto *F = new MCDataFragment();
+  auto *F = allocFragment<MCDataFragment>();
   Result->getFragmentList().insert(Result->begin(), F);
   F->setParent(Result);
 
@@ -869,7 +874,7 @@ MCSectionDXContainer *MCContext::getDXContainerSection(StringRef Section,
       new (DXCAllocator.Allocate()) MCSectionDXContainer(Name, K, nullptr);
 
   // The first fragment will store the header
-  auto *F = new MCDataFragment();
+  auto *F = allocFragment<MCDataFragment>();
   MapIt->second->getFragmentList().insert(MapIt->second->begin(), F);
   F->setParent(MapIt->second);
 
@@ -1003,7 +1008,7 @@ void MCContext::finalizeDwarfSections(MCStreamer &MCOS) {
 
 CodeViewContext &MCContext::getCVContext() {
   if (!CVContext)
-    CVContext.reset(new CodeViewContext);
+    CVContext.reset(new CodeViewContext(this));
   return *CVContext;
 }
 
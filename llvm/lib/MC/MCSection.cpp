@@ -56,7 +56,7 @@ void MCSection::setBundleLockState(BundleLockStateType NewState) {
 }
 
 MCSection::iterator
-MCSection::getSubsectionInsertionPoint(unsigned Subsection) {
+MCSection::getSubsectionInsertionPoint(MCContext &Ctx, unsigned Subsection) {
   if (Subsection == 0 && SubsectionFragmentMap.empty())
     return end();
 
@@ -76,7 +76,7 @@ MCSection::getSubsectionInsertionPoint(unsigned Subsection) {
   if (!ExactMatch && Subsection != 0) {
     // The GNU as documentation claims that subsections have an alignment of 4,
     // although this appears not to be the case.
-    MCFragment *F = new MCDataFragment();
+    MCFragment *F = Ctx.allocFragment<MCDataFragment>();
     SubsectionFragmentMap.insert(MI, std::make_pair(Subsection, F));
     getFragmentList().insert(IP, F);
     F->setParent(this);
@@ -106,17 +106,17 @@ void MCSection::flushPendingLabels(MCFragment *F, uint64_t FOffset,
   }
 }
 
-void MCSection::flushPendingLabels() {
+void MCSection::flushPendingLabels(MCContext &Ctx) {
   // Make sure all remaining pending labels point to data fragments, by
   // creating new empty data fragments for each Subsection with labels pending.
   while (!PendingLabels.empty()) {
     PendingLabel& Label = PendingLabels[0];
     iterator CurInsertionPoint =
-      this->getSubsectionInsertionPoint(Label.Subsection);
+      this->getSubsectionInsertionPoint(Ctx, Label.Subsection);
     const MCSymbol *Atom = nullptr;
     if (CurInsertionPoint != begin())
       Atom = std::prev(CurInsertionPoint)->getAtom();
-    MCFragment *F = new MCDataFragment();
+    MCFragment *F = Ctx.allocFragment<MCDataFragment>();
     getFragmentList().insert(CurInsertionPoint, F);
     F->setParent(this);
     F->setAtom(Atom);
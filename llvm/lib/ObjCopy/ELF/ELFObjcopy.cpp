@@ -9,6 +9,7 @@
 #include "llvm/ObjCopy/ELF/ELFObjcopy.h"
 #include "ELFObject.h"
 #include "llvm/ADT/BitmaskEnum.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallVector.h"
@@ -31,6 +32,7 @@
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Memory.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
@@ -39,6 +41,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -522,11 +525,28 @@ static Error replaceAndRemoveSections(const CommonConfig &Config,
     return E;
 
   if (Config.CompressionType != DebugCompressionType::None) {
+    // Compressing is by far the most expensive part of the replacement and
+    // each section is compressed independently, so do it up front in
+    // parallel and only add the results to the object sequentially.
+    SmallVector<const SectionBase *, 13> ToCompress;
+    DenseMap<const SectionBase *, size_t> CompressedIndex;
+    for (const SectionBase &Sec : Obj.sections())
+      if (isCompressable(Sec)) {
+        CompressedIndex[&Sec] = ToCompress.size();
+        ToCompress.push_back(&Sec);
+      }
+    SmallVector<std::optional<CompressedSection>, 13> Compressed(
+        ToCompress.size());
+    parallelFor(0, ToCompress.size(), [&](size_t I) {
+      Compressed[I].emplace(*ToCompress[I], Config.CompressionType,
+                            Obj.Is64Bits);
+    });
+
     if (Error Err = replaceDebugSections(
             Obj, isCompressable,
-            [&Config, &Obj](const SectionBase *S) -> Expected<SectionBase *> {
+            [&](const SectionBase *S) -> Expected<SectionBase *> {
               return &Obj.addSection<CompressedSection>(
-                  CompressedSection(*S, Config.CompressionType, Obj.Is64Bits));
+                  std::move(*Compressed[CompressedIndex.lookup(S)]));
             }))
       return Err;
   } else if (Config.DecompressDebugSections) {
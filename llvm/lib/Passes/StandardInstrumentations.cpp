@@ -122,6 +122,11 @@ static cl::opt<unsigned>
                 cl::desc("Print IR at pass with this number as "
                          "reported by print-passes-names"));
 
+static cl::opt<unsigned> PassFunctionCostReport(
+    "pass-function-cost-report", cl::init(0), cl::Hidden,
+    cl::desc("Print the N (pass, function) pairs that took the most time, "
+             "with the function's instruction count before and after"));
+
 static cl::opt<std::string> IRDumpDirectory(
     "ir-dump-directory",
     cl::desc("If specified, IR printed using the "
@@ -1505,6 +1510,77 @@ void TimeProfilingPassesHandler::runBeforePass(StringRef PassID, Any IR) {
 
 void TimeProfilingPassesHandler::runAfterPass() { timeTraceProfilerEnd(); }
 
+void PassFunctionCostReporter::registerCallbacks(
+    PassInstrumentationCallbacks &PIC) {
+  if (!PassFunctionCostReport)
+    return;
+  PIC.registerBeforeNonSkippedPassCallback(
+      [this](StringRef P, Any IR) { this->runBeforePass(P, IR); });
+  PIC.registerAfterPassCallback(
+      [this](StringRef P, Any IR, const PreservedAnalyses &) {
+        this->runAfterPass(P, /*Invalidated=*/false);
+      },
+      true);
+  PIC.registerAfterPassInvalidatedCallback(
+      [this](StringRef P, const PreservedAnalyses &) {
+        this->runAfterPass(P, /*Invalidated=*/true);
+      },
+      true);
+}
+
+void PassFunctionCostReporter::runBeforePass(StringRef PassID, Any IR) {
+  if (isSpecialPass(PassID, {"PassManager", "PassAdaptor"}))
+    return;
+  const Function *F = nullptr;
+  bool IsLoop = false;
+  if (const auto **FPtr = llvm::any_cast<const Function *>(&IR)) {
+    F = *FPtr;
+  } else if (const auto **L = llvm::any_cast<const Loop *>(&IR)) {
+    F = (*L)->getHeader()->getParent();
+    IsLoop = true;
+  }
+  Stack.push_back({F, IsLoop, std::chrono::steady_clock::now(),
+                   F ? F->getInstructionCount() : 0});
+}
+
+void PassFunctionCostReporter::runAfterPass(StringRef PassID,
+                                            bool Invalidated) {
+  if (isSpecialPass(PassID, {"PassManager", "PassAdaptor"}))
+    return;
+  assert(!Stack.empty() && "unbalanced pass callbacks");
+  Running R = Stack.pop_back_val();
+  // An invalidated function may have been deleted, so don't look at it.
+  if (!R.F || (Invalidated && !R.IsLoop))
+    return;
+  double Seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - R.Start)
+                       .count();
+  if (Slowest.size() == PassFunctionCostReport) {
+    if (Seconds <= Slowest.front().Seconds)
+      return;
+    std::pop_heap(Slowest.begin(), Slowest.end(), std::greater<Entry>());
+    Slowest.pop_back();
+  }
+  Slowest.push_back({Seconds, PassID.str(), R.F->getName().str(),
+                     R.InstsBefore, R.F->getInstructionCount()});
+  std::push_heap(Slowest.begin(), Slowest.end(), std::greater<Entry>());
+}
+
+PassFunctionCostReporter::~PassFunctionCostReporter() {
+  if (Slowest.empty())
+    return;
+  std::sort_heap(Slowest.begin(), Slowest.end(), std::greater<Entry>());
+  raw_ostream &OS = errs();
+  OS << "===" << std::string(73, '-') << "===\n"
+     << "  Slowest (pass, function) pairs\n"
+     << "===" << std::string(73, '-') << "===\n"
+     << "   Seconds  Insts before  Insts after  Pass / Function\n";
+  for (const Entry &E : Slowest)
+    OS << format("%10.4f  %12u  %11u  ", E.Seconds, E.InstsBefore,
+                 E.InstsAfter)
+       << E.Pass << " / " << E.Function << "\n";
+}
+
 namespace {
 
 class DisplayNode;
@@ -2426,6 +2502,7 @@ void StandardInstrumentations::registerCallbacks(
   PrintIR.registerCallbacks(PIC);
   PrintPass.registerCallbacks(PIC);
   TimePasses.registerCallbacks(PIC);
+  PassFunctionCosts.registerCallbacks(PIC);
   OptNone.registerCallbacks(PIC);
   OptPassGate.registerCallbacks(PIC);
   PrintChangedIR.registerCallbacks(PIC);
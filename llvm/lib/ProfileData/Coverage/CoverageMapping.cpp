@@ -14,6 +14,7 @@
 #include "llvm/ProfileData/Coverage/CoverageMapping.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/SmallBitVector.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringExtras.h"
@@ -794,12 +795,15 @@ public:
 } // end anonymous namespace
 
 std::vector<StringRef> CoverageMapping::getUniqueSourceFiles() const {
+  // Most functions share their headers with many others, so deduplicate
+  // while collecting rather than sorting every (function, file) pair.
   std::vector<StringRef> Filenames;
+  DenseSet<StringRef> Seen;
   for (const auto &Function : getCoveredFunctions())
-    llvm::append_range(Filenames, Function.Filenames);
+    for (const std::string &Filename : Function.Filenames)
+      if (Seen.insert(Filename).second)
+        Filenames.push_back(Filename);
   llvm::sort(Filenames);
-  auto Last = std::unique(Filenames.begin(), Filenames.end());
-  Filenames.erase(Last, Filenames.end());
   return Filenames;
 }
 
@@ -1164,6 +1164,7 @@ std::error_code SampleProfileReaderExtBinaryBase::readCSNameTableSec() {
     auto ContextSize = readNumber<uint32_t>();
     if (std::error_code EC = ContextSize.getError())
       return EC;
+    CSNameTable.back().reserve(*ContextSize);
     for (uint32_t J = 0; J < *ContextSize; ++J) {
       auto FName(readStringFromTable());
       if (std::error_code EC = FName.getError())
@@ -11,6 +11,7 @@
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/Threading.h"
 
+#include <algorithm>
 #include <atomic>
 #include <deque>
 #include <future>
@@ -235,17 +236,20 @@ void llvm::parallelFor(size_t Begin, size_t End,
     if (TaskSize == 0)
       TaskSize = 1;
 
+    // Rather than queueing one task per chunk, spawn one task per thread and
+    // let each of them claim chunks until the range is exhausted. This keeps
+    // the same load balancing while taking the executor's queue lock only
+    // once per thread instead of once per chunk.
+    std::atomic<size_t> Next{Begin};
+    size_t NumTasks = std::min<size_t>(parallel::getThreadCount(),
+                                       (NumItems + TaskSize - 1) / TaskSize);
     parallel::TaskGroup TG;
-    for (; Begin + TaskSize < End; Begin += TaskSize) {
-      TG.spawn([=, &Fn] {
-        for (size_t I = Begin, E = Begin + TaskSize; I != E; ++I)
-          Fn(I);
-      });
-    }
-    if (Begin != End) {
-      TG.spawn([=, &Fn] {
-        for (size_t I = Begin; I != End; ++I)
-          Fn(I);
+    for (size_t T = 0; T != NumTasks; ++T) {
+      TG.spawn([=, &Next, &Fn] {
+        for (size_t B = Next.fetch_add(TaskSize); B < End;
+             B = Next.fetch_add(TaskSize))
+          for (size_t I = B, E = std::min(End, B + TaskSize); I != E; ++I)
+            Fn(I);
       });
     }
     return;
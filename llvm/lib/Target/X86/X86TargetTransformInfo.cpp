@@ -55,6 +55,7 @@
 #include "llvm/CodeGen/TargetLowering.h"
 #include "llvm/IR/InstIterator.h"
 #include "llvm/IR/IntrinsicInst.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include <optional>
 
@@ -62,6 +63,17 @@ using namespace llvm;
 
 #define DEBUG_TYPE "x86tti"
 
+// Gathers on some AVX-512 cores are much slower than the default overhead
+// suggests. These let the gather/scatter cost be raised so that the
+// vectorizers prefer scalarized or interleaved accesses instead.
+static cl::opt<int> X86GatherOverhead(
+    "x86-gather-overhead", cl::Hidden,
+    cl::desc("Override the fixed cost added to each legal gather"));
+
+static cl::opt<int> X86ScatterOverhead(
+    "x86-scatter-overhead", cl::Hidden,
+    cl::desc("Override the fixed cost added to each legal scatter"));
+
 //===----------------------------------------------------------------------===//
 //
 // X86 cost model.
@@ -5655,6 +5667,8 @@ int X86TTIImpl::getGatherOverhead() const {
   // other alternatives.
   // TODO: Remove the explicit hasAVX512()?, That would mean we would only
   // enable gather with a -march.
+  if (X86GatherOverhead.getNumOccurrences())
+    return X86GatherOverhead;
   if (ST->hasAVX512() || (ST->hasAVX2() && ST->hasFastGather()))
     return 2;
 
@@ -5662,6 +5676,8 @@ int X86TTIImpl::getGatherOverhead() const {
 }
 
 int X86TTIImpl::getScatterOverhead() const {
+  if (X86ScatterOverhead.getNumOccurrences())
+    return X86ScatterOverhead;
   if (ST->hasAVX512())
     return 2;
 
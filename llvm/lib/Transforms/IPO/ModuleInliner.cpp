@@ -27,6 +27,7 @@
 #include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/Analysis/ReplayInlineAdvisor.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
+#include "llvm/Analysis/TargetTransformInfo.h"
 #include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/InstIterator.h"
@@ -47,6 +48,13 @@ using namespace llvm;
 
 STATISTIC(NumInlined, "Number of functions inlined");
 STATISTIC(NumDeleted, "Number of functions deleted because all callers found");
+STATISTIC(NumOverSizeBudget,
+          "Number of calls not inlined because of the module size budget");
+
+static cl::opt<unsigned> SizeGrowthLimit(
+    "module-inliner-size-growth-limit", cl::init(0), cl::Hidden,
+    cl::desc("Stop inlining once the module has grown by this percentage of "
+             "its initial instruction count (0 = unlimited)"));
 
 /// Return true if the specified inline history ID
 /// indicates an inline history that includes the specified function.
@@ -142,8 +150,10 @@ PreservedAnalyses ModuleInlinerPass::run(Module &M,
   assert(Calls != nullptr && "Expected an initialized InlineOrder");
 
   // Populate the initial list of calls in this module.
+  uint64_t ModuleSize = 0;
   for (Function &F : M) {
     auto &ORE = FAM.getResult<OptimizationRemarkEmitterAnalysis>(F);
+    ModuleSize += F.getInstructionCount();
     for (Instruction &I : instructions(F))
       if (auto *CB = dyn_cast<CallBase>(&I))
         if (Function *Callee = CB->getCalledFunction()) {
@@ -175,6 +185,12 @@ PreservedAnalyses ModuleInlinerPass::run(Module &M,
   // defer deleting these to make it easier to handle the call graph updates.
   SmallVector<Function *, 4> DeadFunctions;
 
+  // With -module-inliner-size-growth-limit, the module may grow by at most
+  // SizeBudget instructions. Growth is estimated from callee sizes, since
+  // recounting the caller after every inline would be quadratic.
+  const int64_t SizeBudget = ModuleSize * SizeGrowthLimit / 100;
+  int64_t SizeGrowth = 0;
+
   // Loop forward over all of the calls.
   while (!Calls->empty()) {
     auto P = Calls->pop();
@@ -205,6 +221,25 @@ PreservedAnalyses ModuleInlinerPass::run(Module &M,
       continue;
     }
 
+    // Mandatory inlining (e.g. of always_inline callees) is never refused,
+    // though it still counts against the budget.
+    int64_t CalleeSize = 0;
+    if (SizeGrowthLimit) {
+      CalleeSize = Callee.getInstructionCount();
+      auto IsMandatory = [&]() {
+        std::optional<InlineResult> Decision =
+            getAttributeBasedInliningDecision(
+                *CB, &Callee, FAM.getResult<TargetIRAnalysis>(Callee), GetTLI);
+        return Decision && Decision->isSuccess();
+      };
+      if (SizeGrowth + CalleeSize > SizeBudget && !IsMandatory()) {
+        setInlineRemark(*CB, "module size budget");
+        Advice->recordUnattemptedInlining();
+        ++NumOverSizeBudget;
+        continue;
+      }
+    }
+
     // Setup the data structure used to plumb customization into the
     // `InlineFunction` routine.
     InlineFunctionInfo IFI(
@@ -222,6 +257,7 @@ PreservedAnalyses ModuleInlinerPass::run(Module &M,
 
     Changed = true;
     ++NumInlined;
+    SizeGrowth += CalleeSize;
 
     LLVM_DEBUG(dbgs() << "    Size after inlining: " << F.getInstructionCount()
                       << "\n");
@@ -261,6 +297,8 @@ PreservedAnalyses ModuleInlinerPass::run(Module &M,
         Calls->erase_if([&](const std::pair<CallBase *, int> &Call) {
           return Call.first->getCaller() == &Callee;
         });
+        if (SizeGrowthLimit)
+          SizeGrowth -= Callee.getInstructionCount();
         // Clear the body and queue the function itself for deletion when we
         // finish inlining.
         // Note that after this point, it is an error to do anything other
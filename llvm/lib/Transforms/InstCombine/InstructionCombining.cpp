@@ -119,6 +119,9 @@ STATISTIC(NumTwoIterations, "Number of functions with two iterations");
 STATISTIC(NumThreeIterations, "Number of functions with three iterations");
 STATISTIC(NumFourOrMoreIterations,
           "Number of functions with four or more iterations");
+STATISTIC(NumIterationLimitReached,
+          "Number of functions where the iteration limit was reached before "
+          "the fixpoint was verified");
 
 STATISTIC(NumCombined , "Number of insts combined");
 STATISTIC(NumConstProp, "Number of constant folds");
@@ -4385,6 +4388,7 @@ static bool combineInstructionsOverFunction(
 
   // Iterate while there is work to do.
   unsigned Iteration = 0;
+  bool ReachedLimit = false;
   while (true) {
     ++Iteration;
 
@@ -4392,6 +4396,13 @@ static bool combineInstructionsOverFunction(
       LLVM_DEBUG(dbgs() << "\n\n[IC] Iteration limit #" << MaxIterations
                         << " on " << F.getName()
                         << " reached; stopping without verifying fixpoint\n");
+      // Getting here means the last allowed iteration changed the IR. That is
+      // expected with a single iteration, the default, so only count it when
+      // the limit was raised.
+      if (MaxIterations > 1) {
+        ReachedLimit = true;
+        ++NumIterationLimitReached;
+      }
       break;
     }
 
@@ -4424,6 +4435,23 @@ static bool combineInstructionsOverFunction(
   else
     ++NumFourOrMoreIterations;
 
+  // With a raised iteration limit, a function that needs more than two
+  // iterations (one that changes the IR and one that confirms the fixpoint)
+  // usually has combines that undo each other, or that only enable each other
+  // one step at a time. Report it so such functions can be found with
+  // -pass-remarks-analysis=instcombine.
+  // When the limit is reached, Iteration is one past the iterations that ran.
+  const unsigned NumIterations = ReachedLimit ? Iteration - 1 : Iteration;
+  if (NumIterations > 2 || ReachedLimit)
+    ORE.emit([&]() {
+      return OptimizationRemarkAnalysis(DEBUG_TYPE, "FixpointIterations",
+                                        F.getSubprogram(), &F.getEntryBlock())
+             << "instcombine needed " << ore::NV("Iterations", NumIterations)
+             << " iterations on function "
+             << ore::NV("Function", F.getName())
+             << (ReachedLimit ? " and hit the iteration limit" : "");
+    });
+
   return MadeIRChange;
 }
 
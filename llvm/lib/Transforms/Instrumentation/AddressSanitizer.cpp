@@ -68,6 +68,7 @@
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/RandomNumberGenerator.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/TargetParser/Triple.h"
 #include "llvm/Transforms/Instrumentation.h"
@@ -84,6 +85,7 @@
 #include <cstdint>
 #include <iomanip>
 #include <limits>
+#include <random>
 #include <sstream>
 #include <string>
 #include <tuple>
@@ -259,6 +261,13 @@ static cl::opt<int> ClMaxInsnsToInstrumentPerBB(
     cl::desc("maximal number of instructions to instrument in any given BB"),
     cl::Hidden);
 
+static cl::opt<float> ClRandomKeepRate(
+    "asan-random-rate",
+    cl::desc("Probability value in the range [0.0, 1.0] to keep the memory "
+             "access checks of a function. Stack and global poisoning are "
+             "not affected."),
+    cl::Hidden, cl::init(1.0));
+
 // This flag may need to be replaced with -f[no]asan-stack.
 static cl::opt<bool> ClStack("asan-stack", cl::desc("Handle stack memory"),
                              cl::Hidden, cl::init(true));
@@ -648,14 +657,15 @@ struct AddressSanitizer {
                    bool CompileKernel = false, bool Recover = false,
                    bool UseAfterScope = false,
                    AsanDetectStackUseAfterReturnMode UseAfterReturn =
-                       AsanDetectStackUseAfterReturnMode::Runtime)
+                       AsanDetectStackUseAfterReturnMode::Runtime,
+                   RandomNumberGenerator *Rng = nullptr)
       : CompileKernel(ClEnableKasan.getNumOccurrences() > 0 ? ClEnableKasan
                                                             : CompileKernel),
         Recover(ClRecover.getNumOccurrences() > 0 ? ClRecover : Recover),
         UseAfterScope(UseAfterScope || ClUseAfterScope),
         UseAfterReturn(ClUseAfterReturn.getNumOccurrences() ? ClUseAfterReturn
                                                             : UseAfterReturn),
-        SSGI(SSGI) {
+        SSGI(SSGI), Rng(Rng) {
     C = &(M.getContext());
     DL = &M.getDataLayout();
     LongSize = M.getDataLayout().getPointerSizeInBits();
@@ -771,6 +781,7 @@ private:
   Value *LocalDynamicShadow = nullptr;
   const StackSafetyGlobalInfo *SSGI;
   DenseMap<const AllocaInst *, bool> ProcessedAllocas;
+  RandomNumberGenerator *Rng;
 
   FunctionCallee AMDGPUAddressShared;
   FunctionCallee AMDGPUAddressPrivate;
@@ -1161,10 +1172,15 @@ PreservedAnalyses AddressSanitizerPass::run(Module &M,
   auto &FAM = MAM.getResult<FunctionAnalysisManagerModuleProxy>(M).getManager();
   const StackSafetyGlobalInfo *const SSGI =
       ClUseStackSafety ? &MAM.getResult<StackSafetyGlobalAnalysis>(M) : nullptr;
+  // The functions of a module share one generator, so that each of them gets
+  // its own draw for -asan-random-rate.
+  std::unique_ptr<RandomNumberGenerator> Rng;
+  if (ClRandomKeepRate.getNumOccurrences())
+    Rng = M.createRNG(DEBUG_TYPE);
   for (Function &F : M) {
     AddressSanitizer FunctionSanitizer(M, SSGI, Options.CompileKernel,
                                        Options.Recover, Options.UseAfterScope,
-                                       Options.UseAfterReturn);
+                                       Options.UseAfterReturn, Rng.get());
     const TargetLibraryInfo &TLI = FAM.getResult<TargetLibraryAnalysis>(F);
     Modified |= FunctionSanitizer.instrumentFunction(F, &TLI);
   }
@@ -2832,7 +2848,11 @@ bool AddressSanitizer::instrumentFunction(Function &F,
   markEscapedLocalAllocas(F);
 
   // We want to instrument every address only once per basic block (unless there
-  // are calls between uses).
+  // are calls between uses). Any call may free the memory, so extending this
+  // to dominating checks in other blocks would require proving that no call
+  // sits on any path between them; merging the per-iteration checks of a loop
+  // into a single range check would additionally need SCEV bounds and a
+  // range-checking runtime entry point.
   SmallPtrSet<Value *, 16> TempsToInstrument;
   SmallVector<InterestingMemoryOperand, 16> OperandsToInstrument;
   SmallVector<MemIntrinsic *, 16> IntrinToInstrument;
@@ -2894,6 +2914,18 @@ bool AddressSanitizer::instrumentFunction(Function &F,
     }
   }
 
+  // With -asan-random-rate only a random subset of functions gets access
+  // checks. The rest still poison their stack, so the checked functions keep
+  // catching bad accesses into it.
+  if (Rng) {
+    std::bernoulli_distribution D(std::clamp(ClRandomKeepRate.getValue(),
+                                             0.0f, 1.0f));
+    if (!D(*Rng)) {
+      OperandsToInstrument.clear();
+      IntrinToInstrument.clear();
+    }
+  }
+
   bool UseCalls = (ClInstrumentationWithCallsThreshold >= 0 &&
                    OperandsToInstrument.size() + IntrinToInstrument.size() >
                        (unsigned)ClInstrumentationWithCallsThreshold);
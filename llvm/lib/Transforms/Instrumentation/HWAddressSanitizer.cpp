@@ -1384,6 +1384,11 @@ bool HWAddressSanitizer::instrumentStack(memtag::StackInfo &SInfo,
   // (unless we use ASan-style mega-alloca). Instead we keep the base tag in a
   // temp, shift-OR it into each alloca address and xor with the retag mask.
   // This generates one extra instruction per alloca use.
+  //
+  // Allocas that StackSafetyAnalysis proves are only accessed in bounds never
+  // reach this loop (see memtag::StackInfoBuilder::isInterestingAlloca), so
+  // they are neither tagged nor untagged, and ignoreAccess drops the checks
+  // of provably safe accesses.
   unsigned int I = 0;
 
   for (auto &KV : SInfo.AllocasToInstrument) {
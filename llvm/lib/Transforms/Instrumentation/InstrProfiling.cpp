@@ -786,6 +786,12 @@ void InstrProfiling::lowerIncrement(InstrProfIncrementInst *Inc) {
     Builder.CreateAtomicRMW(AtomicRMWInst::Add, Addr, Inc->getStep(),
                             MaybeAlign(), AtomicOrdering::Monotonic);
   } else {
+    // A plain load/add/store keeps the common single-threaded case cheap but
+    // still makes threads that bump the same hot counter bounce its cache
+    // line. Counter promotion (see PGOCounterPromoter) is the mitigation we
+    // have: it sinks loop counter updates to the loop exits. Per-thread
+    // counter shards would also need the runtime to allocate and sum the
+    // copies of __llvm_prf_cnts when the profile is written.
     Value *IncStep = Inc->getStep();
     Value *Load = Builder.CreateLoad(IncStep->getType(), Addr, "pgocount");
     auto *Count = Builder.CreateAdd(Load, Inc->getStep());
@@ -589,6 +589,10 @@ static bool IsBackEdge(BasicBlock *From, BasicBlock *To,
 //
 // Note that Cmp pruning is controlled by the same flag as the
 // BB pruning.
+// Comparisons that only decide whether to take a loop back edge are typically
+// induction variable checks against the trip count. Tracing them costs a
+// callback per iteration and rarely exposes a value the fuzzer can use, so
+// they are pruned unless NoPrune is set.
 static bool IsInterestingCmp(ICmpInst *CMP, const DominatorTree *DT,
                              const SanitizerCoverageOptions &Options) {
   if (!Options.NoPrune)
@@ -124,6 +124,11 @@ static cl::opt<uint32_t> MaxBBSpeculations(
              "into) when deducing if a value is fully available or not in GVN "
              "(default = 600)"));
 
+static cl::opt<uint32_t> MaxNumNonLocalLoadQueries(
+    "gvn-max-nonlocal-load-queries", cl::Hidden, cl::init(0),
+    cl::desc("Max number of non-local load dependency queries per function; "
+             "loads beyond it are only optimized locally (0 = unlimited)"));
+
 static cl::opt<uint32_t> MaxNumVisitedInsts(
     "gvn-max-num-visited-insts", cl::Hidden, cl::init(100),
     cl::desc("Max number of visited instructions when trying to find "
@@ -1842,6 +1847,13 @@ bool GVNPass::processNonLocalLoad(LoadInst *Load) {
           Attribute::SanitizeHWAddress))
     return false;
 
+  // Each query may walk up to memdep-block-number-limit blocks, so on huge
+  // functions the total is quadratic. Stop once the per-function budget is
+  // used up.
+  if (MaxNumNonLocalLoadQueries &&
+      NumNonLocalLoadQueries++ >= MaxNumNonLocalLoadQueries)
+    return false;
+
   // Step 1: Find the non-local dependencies of the load.
   LoadDepVect Deps;
   MD->getNonLocalPointerDependency(Load, Deps);
@@ -2700,6 +2712,7 @@ bool GVNPass::runImpl(Function &F, AssumptionCache &RunAC, DominatorTree &RunDT,
   VN.setMemDep(MD);
   ORE = RunORE;
   InvalidBlockRPONumbers = true;
+  NumNonLocalLoadQueries = 0;
   MemorySSAUpdater Updater(MSSA);
   MSSAU = MSSA ? &Updater : nullptr;
 
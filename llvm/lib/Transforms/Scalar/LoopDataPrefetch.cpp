@@ -16,9 +16,12 @@
 #include "llvm/ADT/DepthFirstIterator.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/AssumptionCache.h"
+#include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/Analysis/CodeMetrics.h"
+#include "llvm/Analysis/LazyBlockFrequencyInfo.h"
 #include "llvm/Analysis/LoopInfo.h"
 #include "llvm/Analysis/OptimizationRemarkEmitter.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/Analysis/ScalarEvolution.h"
 #include "llvm/Analysis/ScalarEvolutionExpressions.h"
 #include "llvm/Analysis/TargetTransformInfo.h"
@@ -54,6 +57,11 @@ static cl::opt<unsigned> MaxPrefetchIterationsAhead(
     "max-prefetch-iters-ahead",
     cl::desc("Max number of iterations to prefetch ahead"), cl::Hidden);
 
+static cl::opt<bool> PrefetchHotLoopsOnly(
+    "loop-prefetch-hot-loops-only", cl::Hidden, cl::init(false),
+    cl::desc("When profile data is available, only prefetch in loops whose "
+             "header is hot"));
+
 STATISTIC(NumPrefetches, "Number of prefetches inserted");
 
 namespace {
@@ -63,8 +71,11 @@ class LoopDataPrefetch {
 public:
   LoopDataPrefetch(AssumptionCache *AC, DominatorTree *DT, LoopInfo *LI,
                    ScalarEvolution *SE, const TargetTransformInfo *TTI,
-                   OptimizationRemarkEmitter *ORE)
-      : AC(AC), DT(DT), LI(LI), SE(SE), TTI(TTI), ORE(ORE) {}
+                   OptimizationRemarkEmitter *ORE,
+                   ProfileSummaryInfo *PSI = nullptr,
+                   BlockFrequencyInfo *BFI = nullptr)
+      : AC(AC), DT(DT), LI(LI), SE(SE), TTI(TTI), ORE(ORE), PSI(PSI),
+        BFI(BFI) {}
 
   bool run();
 
@@ -109,6 +120,10 @@ private:
   ScalarEvolution *SE;
   const TargetTransformInfo *TTI;
   OptimizationRemarkEmitter *ORE;
+  /// Only set when -loop-prefetch-hot-loops-only is given and the module has
+  /// a profile summary.
+  ProfileSummaryInfo *PSI;
+  BlockFrequencyInfo *BFI;
 };
 
 /// Legacy class for inserting loop data prefetches.
@@ -128,6 +143,10 @@ public:
     AU.addRequiredID(LoopSimplifyID);
     AU.addPreservedID(LoopSimplifyID);
     AU.addRequired<OptimizationRemarkEmitterWrapperPass>();
+    if (PrefetchHotLoopsOnly) {
+      AU.addRequired<ProfileSummaryInfoWrapperPass>();
+      LazyBlockFrequencyInfoPass::getLazyBFIAnalysisUsage(AU);
+    }
     AU.addRequired<ScalarEvolutionWrapperPass>();
     AU.addPreserved<ScalarEvolutionWrapperPass>();
     AU.addRequired<TargetTransformInfoWrapperPass>();
@@ -145,6 +164,8 @@ INITIALIZE_PASS_DEPENDENCY(TargetTransformInfoWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(LoopInfoWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(LoopSimplify)
 INITIALIZE_PASS_DEPENDENCY(OptimizationRemarkEmitterWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(ProfileSummaryInfoWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(LazyBFIPass)
 INITIALIZE_PASS_DEPENDENCY(ScalarEvolutionWrapperPass)
 INITIALIZE_PASS_END(LoopDataPrefetchLegacyPass, "loop-data-prefetch",
                     "Loop Data Prefetch", false, false)
@@ -178,8 +199,16 @@ PreservedAnalyses LoopDataPrefetchPass::run(Function &F,
   OptimizationRemarkEmitter *ORE =
       &AM.getResult<OptimizationRemarkEmitterAnalysis>(F);
   const TargetTransformInfo *TTI = &AM.getResult<TargetIRAnalysis>(F);
+  ProfileSummaryInfo *PSI = nullptr;
+  BlockFrequencyInfo *BFI = nullptr;
+  if (PrefetchHotLoopsOnly) {
+    auto &MAMProxy = AM.getResult<ModuleAnalysisManagerFunctionProxy>(F);
+    PSI = MAMProxy.getCachedResult<ProfileSummaryAnalysis>(*F.getParent());
+    if (PSI && PSI->hasProfileSummary())
+      BFI = &AM.getResult<BlockFrequencyAnalysis>(F);
+  }
 
-  LoopDataPrefetch LDP(AC, DT, LI, SE, TTI, ORE);
+  LoopDataPrefetch LDP(AC, DT, LI, SE, TTI, ORE, PSI, BFI);
   bool Changed = LDP.run();
 
   if (Changed) {
@@ -205,8 +234,15 @@ bool LoopDataPrefetchLegacyPass::runOnFunction(Function &F) {
       &getAnalysis<OptimizationRemarkEmitterWrapperPass>().getORE();
   const TargetTransformInfo *TTI =
       &getAnalysis<TargetTransformInfoWrapperPass>().getTTI(F);
+  ProfileSummaryInfo *PSI = nullptr;
+  BlockFrequencyInfo *BFI = nullptr;
+  if (PrefetchHotLoopsOnly) {
+    PSI = &getAnalysis<ProfileSummaryInfoWrapperPass>().getPSI();
+    if (PSI->hasProfileSummary())
+      BFI = &getAnalysis<LazyBlockFrequencyInfoPass>().getBFI();
+  }
 
-  LoopDataPrefetch LDP(AC, DT, LI, SE, TTI, ORE);
+  LoopDataPrefetch LDP(AC, DT, LI, SE, TTI, ORE, PSI, BFI);
   return LDP.run();
 }
 
@@ -278,6 +314,13 @@ bool LoopDataPrefetch::runOnLoop(Loop *L) {
   if (!L->isInnermost())
     return MadeChange;
 
+  // With profile data, prefetches in cold loops only cost code size and issue
+  // bandwidth.
+  if (BFI && !PSI->isHotBlock(L->getHeader(), BFI)) {
+    LLVM_DEBUG(dbgs() << "Skipping cold loop: " << *L);
+    return MadeChange;
+  }
+
   SmallPtrSet<const Value *, 32> EphValues;
   CodeMetrics::collectEphemeralValues(L, AC, EphValues);
 
@@ -33,6 +33,11 @@
 // alternative vectorization path that is natively implemented on top of the
 // VPlan infrastructure. See EnableVPlanNativePath for enabling.
 //
+// All decisions are made for the single set of target features of the
+// enclosing function: code generation is per function, so a loop cannot be
+// vectorized for a wider ISA than its function. Per-ISA versions of hot code
+// are obtained with function multiversioning (target_clones) instead.
+//
 //===----------------------------------------------------------------------===//
 //
 // The reduction-variable vectorization is based on the paper:
@@ -150,6 +150,14 @@ static cl::opt<int>
 ScheduleRegionSizeBudget("slp-schedule-budget", cl::init(100000), cl::Hidden,
     cl::desc("Limit the size of the SLP scheduling region per block"));
 
+/// Limits the total number of tree entries built per function, across all
+/// seeds. Without it, a huge generated function with many seed candidates can
+/// spend most of the pipeline's time in repeated buildTree calls.
+static cl::opt<unsigned> TreeBuildBudget(
+    "slp-tree-build-budget", cl::init(0), cl::Hidden,
+    cl::desc("Limit the number of SLP tree entries built per function "
+             "(0=unlimited)"));
+
 static cl::opt<int> MinVectorRegSizeOption(
     "slp-min-reg-size", cl::init(128), cl::Hidden,
     cl::desc("Attempt to vectorize for this register size in bits"));
@@ -1165,6 +1173,11 @@ public:
   /// Construct a vectorizable tree that starts at \p Roots.
   void buildTree(ArrayRef<Value *> Roots);
 
+  /// \returns true (and emits a remark the first time) if this function has
+  /// already built more tree entries than -slp-tree-build-budget allows. Trees
+  /// are left empty from then on, so every seed is rejected as too small.
+  bool exceededTreeBuildBudget();
+
   /// Returns whether the root node has in-tree uses.
   bool doesRootHaveInTreeUses() const {
     return !VectorizableTree.empty() &&
@@ -3675,6 +3688,10 @@ private:
   unsigned MaxVecRegSize; // This is set by TTI or overridden by cl::opt.
   unsigned MinVecRegSize; // Set by cl::opt (default: 128).
 
+  /// Tree entries built so far in this function, for -slp-tree-build-budget.
+  unsigned NumTreeEntriesBuilt = 0;
+  bool ReportedBudgetExceeded = false;
+
   /// Instruction builder to construct the vectorized tree.
   IRBuilder<> Builder;
 
@@ -5198,20 +5215,38 @@ BoUpSLP::findExternalStoreUsersReorderIndices(TreeEntry *TE) const {
   return ExternalReorderIndices;
 }
 
+bool BoUpSLP::exceededTreeBuildBudget() {
+  if (!TreeBuildBudget || NumTreeEntriesBuilt < TreeBuildBudget)
+    return false;
+  if (!ReportedBudgetExceeded) {
+    ReportedBudgetExceeded = true;
+    ORE->emit([&]() {
+      return OptimizationRemarkMissed(SV_NAME, "BudgetExceeded",
+                                      F->getSubprogram(), &F->getEntryBlock())
+             << "Stopped SLP vectorization in function: built "
+             << ore::NV("TreeEntries", NumTreeEntriesBuilt)
+             << " tree entries, over the budget set by -slp-tree-build-budget";
+    });
+  }
+  return true;
+}
+
 void BoUpSLP::buildTree(ArrayRef<Value *> Roots,
                         const SmallDenseSet<Value *> &UserIgnoreLst) {
   deleteTree();
   UserIgnoreList = &UserIgnoreLst;
-  if (!allSameType(Roots))
+  if (!allSameType(Roots) || exceededTreeBuildBudget())
     return;
   buildTree_rec(Roots, 0, EdgeInfo());
+  NumTreeEntriesBuilt += VectorizableTree.size();
 }
 
 void BoUpSLP::buildTree(ArrayRef<Value *> Roots) {
   deleteTree();
-  if (!allSameType(Roots))
+  if (!allSameType(Roots) || exceededTreeBuildBudget())
     return;
   buildTree_rec(Roots, 0, EdgeInfo());
+  NumTreeEntriesBuilt += VectorizableTree.size();
 }
 
 /// \return true if the specified list of values has only one instruction that
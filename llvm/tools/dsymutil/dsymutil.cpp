@@ -701,7 +701,10 @@ int dsymutil_main(int argc, char **argv, const llvm::ToolContext &) {
 
     if (Options.LinkOpts.Update) {
       // The debug map should be empty. Add one object file corresponding to
-      // the input file.
+      // the input file. The existing dSYM is relinked as a single object;
+      // there is no way to replace the contribution of just one rebuilt .o,
+      // since uniqued types and every DIE offset after a changed unit depend
+      // on all of the objects linked before it.
       for (auto &Map : *DebugMapPtrsOrErr)
         Map->addDebugMapObject(InputFile,
                                sys::TimePoint<std::chrono::seconds>());
@@ -33,11 +33,13 @@
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Regex.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/WithColor.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/TargetParser/Triple.h"
 #include <cstdlib>
+#include <mutex>
 
 using namespace llvm;
 using namespace llvm::dwarfdump;
@@ -267,6 +269,12 @@ static cl::opt<bool>
     ShowSources("show-sources",
                 cl::desc("Show the sources across all compilation units."),
                 cat(DwarfDumpCategory));
+static opt<unsigned> NumThreads(
+    "num-threads",
+    desc("Extract the DIEs of all units up front using N threads before "
+         "processing them. 0 uses all available hardware threads. Default 1 "
+         "extracts DIEs lazily on a single thread."),
+    cat(DwarfDumpCategory), init(1), value_desc("N"));
 static opt<bool> Verify("verify", desc("Verify the DWARF debug info."),
                         cat(DwarfDumpCategory));
 static opt<bool> Quiet("quiet", desc("Use with -verify to not emit to STDOUT."),
@@ -711,22 +719,58 @@ static bool handleArchive(StringRef Filename, Archive &Arch,
   return Result;
 }
 
+/// Extract the DIEs of every unit in \p DICtx on a thread pool so that the
+/// handlers, which walk the units serially, find them already parsed.
+static void extractUnitsInParallel(DWARFContext &DICtx) {
+  // Abbreviations are cached in the context, so parse them sequentially
+  // first; DIE extraction then only touches unit-local state.
+  for (const auto &U : DICtx.normal_units())
+    U->getAbbreviations();
+
+  ThreadPool Pool(hardware_concurrency(NumThreads));
+  for (const auto &U : DICtx.normal_units())
+    Pool.async([&U]() { U->getUnitDIE(/*ExtractUnitDIEOnly=*/false); });
+  Pool.wait();
+}
+
+static std::unique_ptr<DWARFContext>
+createContext(const ObjectFile &Obj,
+              std::function<void(Error)> RecoverableErrorHandler,
+              std::function<void(Error)> WarningHandler,
+              bool ParseCUTUIndexManually = false) {
+  bool Parallel = NumThreads != 1;
+  std::unique_ptr<DWARFContext> DICtx = DWARFContext::create(
+      Obj, DWARFContext::ProcessDebugRelocations::Process, nullptr, "",
+      RecoverableErrorHandler, WarningHandler, Parallel);
+  DICtx->setParseCUTUIndexManually(ParseCUTUIndexManually);
+  if (Parallel)
+    extractUnitsInParallel(*DICtx);
+  return DICtx;
+}
+
 static bool handleBuffer(StringRef Filename, MemoryBufferRef Buffer,
                          HandlerFn HandleObj, raw_ostream &OS) {
   Expected<std::unique_ptr<Binary>> BinOrErr = object::createBinary(Buffer);
   error(Filename, BinOrErr.takeError());
 
   bool Result = true;
+  // Errors and warnings may be reported from several threads with
+  // --num-threads, so serialize them to keep messages from interleaving.
+  std::mutex DiagMutex;
   auto RecoverableErrorHandler = [&](Error E) {
+    std::lock_guard<std::mutex> Lock(DiagMutex);
     Result = false;
     WithColor::defaultErrorHandler(std::move(E));
   };
+  auto WarningHandler = [&](Error E) {
+    std::lock_guard<std::mutex> Lock(DiagMutex);
+    WithColor::defaultWarningHandler(std::move(E));
+  };
   if (auto *Obj = dyn_cast<ObjectFile>(BinOrErr->get())) {
     if (filterArch(*Obj)) {
-      std::unique_ptr<DWARFContext> DICtx = DWARFContext::create(
-          *Obj, DWARFContext::ProcessDebugRelocations::Process, nullptr, "",
-          RecoverableErrorHandler);
-      DICtx->setParseCUTUIndexManually(ManuallyGenerateUnitIndex);
+      std::unique_ptr<DWARFContext> DICtx =
+          createContext(*Obj, RecoverableErrorHandler, WarningHandler,
+                        ManuallyGenerateUnitIndex);
       if (!HandleObj(*Obj, *DICtx, Filename, OS))
         Result = false;
     }
@@ -737,9 +781,8 @@ static bool handleBuffer(StringRef Filename, MemoryBufferRef Buffer,
       if (auto MachOOrErr = ObjForArch.getAsObjectFile()) {
         auto &Obj = **MachOOrErr;
         if (filterArch(Obj)) {
-          std::unique_ptr<DWARFContext> DICtx = DWARFContext::create(
-              Obj, DWARFContext::ProcessDebugRelocations::Process, nullptr, "",
-              RecoverableErrorHandler);
+          std::unique_ptr<DWARFContext> DICtx =
+              createContext(Obj, RecoverableErrorHandler, WarningHandler);
           if (!HandleObj(Obj, *DICtx, ObjName, OS))
             Result = false;
         }
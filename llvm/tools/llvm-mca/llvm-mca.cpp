@@ -558,6 +558,13 @@ int main(int argc, char **argv) {
   assert(MAB && "Unable to create asm backend!");
 
   json::Object JSONOutput;
+  // Regions are analyzed one after another. Each region is an independent
+  // simulation (loop-carried dependencies are modeled by replaying the
+  // region for -iterations), but the InstrBuilder cache, the instrument
+  // post-processor state, the Context and the output stream are shared, so
+  // regions cannot simply be simulated concurrently. Batch analysis of many
+  // loops is done by marking each loop body with an LLVM-MCA-BEGIN/END pair
+  // and requesting -json output.
   for (const std::unique_ptr<mca::AnalysisRegion> &Region : Regions) {
     // Skip empty code regions.
     if (Region->empty())
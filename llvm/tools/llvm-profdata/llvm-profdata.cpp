@@ -503,6 +503,9 @@ mergeInstrProfile(const WeightedFileVector &Inputs, StringRef DebugInfoFilename,
                    Contexts[End - 1].get());
         Pool.wait();
       }
+      // The contexts in [Mid, End) have been merged; release their writers
+      // now rather than at the end so that peak memory shrinks every round.
+      Contexts.truncate(Mid);
       End = Mid;
       Mid /= 2;
     } while (Mid > 0);
@@ -12,9 +12,10 @@
 #include "ProfiledBinary.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/LineIterator.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Regex.h"
 #include <cstdint>
-#include <fstream>
 #include <list>
 #include <map>
 #include <vector>
@@ -25,37 +26,33 @@ using namespace sampleprof;
 namespace llvm {
 namespace sampleprof {
 
-// Stream based trace line iterator
+// Line iterator over a trace file. The file is memory mapped rather than read
+// through a stream, so lines are not copied and stay valid until the stream is
+// destroyed.
 class TraceStream {
-  std::string CurrentLine;
-  std::ifstream Fin;
-  bool IsAtEoF = false;
-  uint64_t LineNumber = 0;
+  std::unique_ptr<MemoryBuffer> Buffer;
+  line_iterator LineIt;
 
 public:
-  TraceStream(StringRef Filename) : Fin(Filename.str()) {
-    if (!Fin.good())
+  TraceStream(StringRef Filename) {
+    auto BufferOrErr = MemoryBuffer::getFile(Filename, /*IsText=*/true);
+    if (!BufferOrErr)
       exitWithError("Error read input perf script file", Filename);
-    advance();
+    Buffer = std::move(*BufferOrErr);
+    LineIt = line_iterator(*Buffer, /*SkipBlanks=*/false);
   }
 
   StringRef getCurrentLine() {
-    assert(!IsAtEoF && "Line iterator reaches the End-of-File!");
-    return CurrentLine;
+    assert(!isAtEoF() && "Line iterator reaches the End-of-File!");
+    return *LineIt;
   }
 
-  uint64_t getLineNumber() { return LineNumber; }
+  uint64_t getLineNumber() { return LineIt.line_number(); }
 
-  bool isAtEoF() { return IsAtEoF; }
+  bool isAtEoF() { return LineIt.is_at_eof(); }
 
   // Read the next line
-  void advance() {
-    if (!std::getline(Fin, CurrentLine)) {
-      IsAtEoF = true;
-      return;
-    }
-    LineNumber++;
-  }
+  void advance() { ++LineIt; }
 };
 
 // The type of input format.
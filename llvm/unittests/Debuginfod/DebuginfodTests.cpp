@@ -67,3 +67,25 @@ TEST(DebuginfodClient, CacheMiss) {
   // A cache miss with no possible URLs should not create the cache directory.
   EXPECT_FALSE(sys::fs::exists(CacheDir));
 }
+
+// Check that a batch prefetch reports artifacts that cannot be fetched with an
+// empty path, in the order they were requested.
+TEST(DebuginfodClient, PrefetchMiss) {
+  SmallString<32> CacheDir;
+  ASSERT_NO_ERROR(
+      sys::fs::createUniqueDirectory("debuginfod-unittest", CacheDir));
+  sys::path::append(CacheDir, "cachedir");
+  setenv("DEBUGINFOD_CACHE_PATH", CacheDir.c_str(),
+         /*replace=*/1);
+  // Ensure there are no urls to guarantee a cache miss.
+  setenv("DEBUGINFOD_URLS", "", /*replace=*/1);
+  HTTPClient::initialize();
+  const uint8_t ID0[] = {0x01, 0x02};
+  const uint8_t ID1[] = {0x03, 0x04};
+  object::BuildIDRef IDs[] = {ID0, ID1};
+  std::vector<std::string> Paths = prefetchDebuginfo(IDs);
+  ASSERT_EQ(Paths.size(), 2u);
+  EXPECT_TRUE(Paths[0].empty());
+  EXPECT_TRUE(Paths[1].empty());
+  EXPECT_FALSE(sys::fs::exists(CacheDir));
+}
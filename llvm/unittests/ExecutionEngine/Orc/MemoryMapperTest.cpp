@@ -200,4 +200,52 @@ TEST(MemoryMapperTest, InitializeDeinitialize) {
   EXPECT_EQ(DeinitializeCounter, 3);
 }
 
+TEST(MemoryMapperTest, HugePages) {
+  // Segments of a reservation made with huge pages must still be protected
+  // one page at a time.
+  std::unique_ptr<MemoryMapper> Mapper =
+      cantFail(InProcessMemoryMapper::Create(/*UseHugePages=*/true));
+
+  auto PageSize = Mapper->getPageSize();
+  size_t TotalSize = 4 * 1024 * 1024;
+
+  auto Mem = reserve(*Mapper, TotalSize);
+  EXPECT_THAT_ERROR(Mem.takeError(), Succeeded());
+
+  std::string HW = "Hello, world!";
+  std::strcpy(Mapper->prepare(Mem->Start, HW.size() + 1), HW.c_str());
+  std::strcpy(Mapper->prepare(Mem->Start + PageSize, HW.size() + 1),
+              HW.c_str());
+
+  MemoryMapper::AllocInfo Alloc;
+  {
+    MemoryMapper::AllocInfo::SegInfo RWSeg;
+    RWSeg.Offset = 0;
+    RWSeg.ContentSize = HW.size() + 1;
+    RWSeg.ZeroFillSize = PageSize - RWSeg.ContentSize;
+    RWSeg.AG = MemProt::Read | MemProt::Write;
+
+    MemoryMapper::AllocInfo::SegInfo ROSeg;
+    ROSeg.Offset = PageSize;
+    ROSeg.ContentSize = HW.size() + 1;
+    ROSeg.ZeroFillSize = PageSize - ROSeg.ContentSize;
+    ROSeg.AG = MemProt::Read;
+
+    Alloc.MappingBase = Mem->Start;
+    Alloc.Segments.push_back(RWSeg);
+    Alloc.Segments.push_back(ROSeg);
+  }
+
+  auto Init = initialize(*Mapper, Alloc);
+  EXPECT_THAT_ERROR(Init.takeError(), Succeeded());
+  EXPECT_EQ(HW, std::string(Init->toPtr<char *>()));
+  EXPECT_EQ(HW, std::string((*Init + PageSize).toPtr<char *>()));
+
+  std::vector<ExecutorAddr> DeinitAddrs = {*Init};
+  EXPECT_THAT_ERROR(deinitialize(*Mapper, DeinitAddrs), Succeeded());
+
+  std::vector<ExecutorAddr> ReleaseAddrs = {Mem->Start};
+  EXPECT_THAT_ERROR(release(*Mapper, ReleaseAddrs), Succeeded());
+}
+
 } // namespace
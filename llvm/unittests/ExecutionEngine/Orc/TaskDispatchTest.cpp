@@ -7,9 +7,17 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ExecutionEngine/Orc/TaskDispatch.h"
+#include "OrcTestCommon.h"
+#include "llvm/ExecutionEngine/Orc/Core.h"
+#include "llvm/ExecutionEngine/Orc/ExecutorProcessControl.h"
+#include "llvm/Testing/Support/Error.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <chrono>
 #include <future>
+#include <mutex>
+#include <thread>
 
 using namespace llvm;
 using namespace llvm::orc;
@@ -32,4 +40,70 @@ TEST(DynamicThreadPoolDispatchTest, GenericNamedTask) {
   EXPECT_TRUE(F.get());
   D->shutdown();
 }
+
+TEST(DynamicThreadPoolDispatchTest, MaxMaterializationThreads) {
+  // Only materialization tasks are limited, so generic tasks must still run
+  // concurrently: the first task blocks until the second one has run.
+  auto D = std::make_unique<DynamicThreadPoolTaskDispatcher>(1);
+  std::promise<void> P1;
+  auto F1 = P1.get_future();
+  std::promise<bool> P2;
+  auto F2 = P2.get_future();
+  D->dispatch(makeGenericNamedTask(
+      [F1 = std::move(F1), P2 = std::move(P2)]() mutable {
+        F1.wait();
+        P2.set_value(true);
+      }));
+  D->dispatch(makeGenericNamedTask(
+      [P1 = std::move(P1)]() mutable { P1.set_value(); }));
+  EXPECT_TRUE(F2.get());
+  D->shutdown();
+}
+
+TEST(DynamicThreadPoolDispatchTest, MaxMaterializationThreadsQueuesTasks) {
+  // Materialize more symbols than there are materialization threads and check
+  // that the limit is respected and that every queued materialization runs.
+  constexpr size_t MaxThreads = 2;
+  constexpr size_t NumSymbols = 8;
+  ExecutionSession ES(std::make_unique<UnsupportedExecutorProcessControl>(
+      nullptr, std::make_unique<DynamicThreadPoolTaskDispatcher>(MaxThreads)));
+  auto &JD = ES.createBareJITDylib("JD");
+
+  std::mutex M;
+  size_t Running = 0;
+  size_t MaxRunning = 0;
+  size_t Materialized = 0;
+
+  SymbolLookupSet Symbols;
+  for (size_t I = 0; I != NumSymbols; ++I) {
+    auto Name = ES.intern(("S" + Twine(I)).str());
+    Symbols.add(Name);
+    ExecutorSymbolDef Def(ExecutorAddr(I + 1), JITSymbolFlags::Exported);
+    cantFail(JD.define(std::make_unique<SimpleMaterializationUnit>(
+        SymbolFlagsMap({{Name, JITSymbolFlags::Exported}}),
+        [&, Name, Def](std::unique_ptr<MaterializationResponsibility> R) {
+          {
+            std::lock_guard<std::mutex> Lock(M);
+            MaxRunning = std::max(MaxRunning, ++Running);
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          {
+            std::lock_guard<std::mutex> Lock(M);
+            --Running;
+            ++Materialized;
+          }
+          cantFail(R->notifyResolved({{Name, Def}}));
+          cantFail(R->notifyEmitted());
+        })));
+  }
+
+  auto Result = ES.lookup(makeJITDylibSearchOrder(&JD), std::move(Symbols));
+  EXPECT_THAT_EXPECTED(Result, Succeeded());
+  if (Result)
+    EXPECT_EQ(Result->size(), NumSymbols);
+
+  cantFail(ES.endSession());
+  EXPECT_EQ(Materialized, NumSymbols);
+  EXPECT_LE(MaxRunning, MaxThreads);
+}
 #endif
@@ -1338,6 +1338,27 @@ TEST_F(FileCheckTest, Match) {
                        Succeeded());
 }
 
+TEST_F(FileCheckTest, MatchLiteralPrefix) {
+  PatternTester Tester;
+
+  // Check that skipping ahead to the regex's literal prefix finds the same
+  // match as scanning with the regex, including when the last literal
+  // character is quantified.
+  Tester.initNextPattern();
+  ASSERT_FALSE(Tester.parsePattern("abc{{d*}}e"));
+  expectNotFoundError(Tester.match("abde").takeError());
+  EXPECT_THAT_EXPECTED(Tester.match("xx abe abcde"), HasValue(7));
+  Tester.initNextPattern();
+  ASSERT_FALSE(Tester.parsePattern("ab{{c*d}}"));
+  EXPECT_THAT_EXPECTED(Tester.match("a abd"), HasValue(2));
+  EXPECT_THAT_EXPECTED(Tester.match("abcccd"), HasValue(0));
+
+  // Check that patterns containing an alternation still match.
+  Tester.initNextPattern();
+  ASSERT_FALSE(Tester.parsePattern("ab{{c|x}}"));
+  EXPECT_THAT_EXPECTED(Tester.match("a abx"), HasValue(2));
+}
+
 TEST_F(FileCheckTest, MatchParen) {
   PatternTester Tester;
   // Check simple parenthesized expressions
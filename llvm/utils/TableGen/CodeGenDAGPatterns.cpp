@@ -14,6 +14,7 @@
 #include "CodeGenDAGPatterns.h"
 #include "CodeGenInstruction.h"
 #include "CodeGenRegisters.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/STLExtras.h"
@@ -4760,6 +4761,15 @@ void CodeGenDAGPatterns::GenerateVariants() {
     LLVM_DEBUG(errs() << "FOUND VARIANTS OF: ";
                PatternsToMatch[i].getSrcPattern()->dump(); errs() << "\n");
 
+    // Only patterns with the same top level predicates can make a variant
+    // redundant. Find them once, rather than comparing the predicates of every
+    // pattern again for each variant.
+    BitVector SamePredicates(PatternsToMatch.size());
+    for (unsigned p = 0, e = PatternsToMatch.size(); p != e; ++p)
+      if (i == p || PatternsToMatch[i].getPredicates() ==
+                        PatternsToMatch[p].getPredicates())
+        SamePredicates.set(p);
+
     for (unsigned v = 0, e = Variants.size(); v != e; ++v) {
       TreePatternNodePtr Variant = Variants[v];
 
@@ -4768,11 +4778,7 @@ void CodeGenDAGPatterns::GenerateVariants() {
 
       // Scan to see if an instruction or explicit pattern already matches this.
       bool AlreadyExists = false;
-      for (unsigned p = 0, e = PatternsToMatch.size(); p != e; ++p) {
-        // Skip if the top level predicates do not match.
-        if ((i != p) && (PatternsToMatch[i].getPredicates() !=
-                         PatternsToMatch[p].getPredicates()))
-          continue;
+      for (unsigned p : SamePredicates.set_bits()) {
         // Check to see if this variant already exists.
         if (Variant->isIsomorphicTo(PatternsToMatch[p].getSrcPattern(),
                                     DepVars)) {
@@ -4791,6 +4797,7 @@ void CodeGenDAGPatterns::GenerateVariants() {
           PatternsToMatch[i].getDstRegs(),
           PatternsToMatch[i].getAddedComplexity(), Record::getNewUID(Records),
           PatternsToMatch[i].getHwModeFeatures());
+      SamePredicates.push_back(true);
     }
 
     LLVM_DEBUG(errs() << "\n");
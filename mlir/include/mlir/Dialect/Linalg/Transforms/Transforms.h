@@ -189,7 +189,9 @@ using TileSizeComputationFunction =
 struct LinalgTilingOptions {
   /// Computation function that returns the tile sizes for each operation.
   /// Delayed construction of constant tile sizes should occur to interoperate
-  /// with folding.
+  /// with folding. Since it receives the operation being tiled, this is also
+  /// the hook for deriving tile sizes from the op's shape and a target cost
+  /// model instead of fixed values.
   TileSizeComputationFunction tileSizeComputationFunction = nullptr;
 
   LinalgTilingOptions &
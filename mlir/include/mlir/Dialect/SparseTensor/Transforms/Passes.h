@@ -31,7 +31,9 @@ struct OneShotBufferizationOptions;
 /// for parallelization. The loop is made parallel if (1) allowed by the
 /// strategy (e.g., AnyStorageOuterLoop considers either a dense or sparse
 /// outermost loop only), and (2) the generated code is an actual for-loop
-/// (and not a co-iterating while-loop).
+/// (and not a co-iterating while-loop). Parallel loops are emitted as
+/// `scf.parallel`, which can then be mapped to threads, e.g. with
+/// `-convert-scf-to-openmp`.
 enum class SparseParallelizationStrategy {
   kNone,
   kDenseOuterLoop,
@@ -1303,6 +1303,13 @@ LLVM_ENABLE_BITMASK_ENUMS_IN_NAMESPACE();
 
 /// A unique fingerprint for a specific operation, and all of it's internal
 /// operations.
+///
+/// The fingerprint hashes the identity of the IR objects (operation, block and
+/// value pointers) together with their attributes and types. It is meant to
+/// detect whether a given piece of IR changed in place. Two structurally
+/// identical operations, for example the same function parsed twice, get
+/// different fingerprints, so it is not suitable as a content key for caching
+/// compilation results.
 class OperationFingerPrint {
 public:
   OperationFingerPrint(Operation *topOp);
@@ -51,6 +51,13 @@ public:
   /// between applying patterns and simplifying regions. Use `kNoLimit` to
   /// disable this iteration limit.
   ///
+  /// Within an iteration, the worklist already picks up the operations
+  /// affected by a rewrite (users, operands and parents), so changes propagate
+  /// without rescanning. Each further iteration re-walks the whole region to
+  /// catch anything that was missed, and mostly checks for convergence. For
+  /// very large regions, a limit of 1 avoids that sweep, at the cost of
+  /// reporting non-convergence whenever something changed.
+  ///
   /// Note: Only applicable when simplifying entire regions.
   int64_t maxIterations = 10;
 
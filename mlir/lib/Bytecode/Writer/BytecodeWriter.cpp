@@ -1018,6 +1018,12 @@ LogicalResult BytecodeWriter::writeOp(EncodingEmitter &emitter, Operation *op) {
 
     // If the region is not isolated from above, or we are emitting bytecode
     // targeting version <kLazyLoading, we don't use a section.
+    //
+    // Isolated regions are encoded into their own emitter and only refer to
+    // the IRNumbering computed up front, which makes them the natural unit
+    // for parallel encoding. Doing so would still require splitting up the
+    // shared `propertiesSection`, which is appended to as operations are
+    // written, in a deterministic way.
     if (isIsolatedFromAbove &&
         config.bytecodeVersion >= bytecode::kLazyLoading) {
       EncodingEmitter regionEmitter;
@@ -134,10 +134,16 @@ public:
   RefCounted(const RefCounted &) = delete;
   RefCounted &operator=(const RefCounted &) = delete;
 
-  void addRef(int64_t count = 1) { refCount.fetch_add(count); }
+  // Tokens and values are reference counted once per async.execute region, so
+  // keep the counter updates as cheap as for `std::shared_ptr`: taking a new
+  // reference needs no ordering, and dropping one only needs to order prior
+  // accesses before the destruction.
+  void addRef(int64_t count = 1) {
+    refCount.fetch_add(count, std::memory_order_relaxed);
+  }
 
   void dropRef(int64_t count = 1) {
-    int64_t previous = refCount.fetch_sub(count);
+    int64_t previous = refCount.fetch_sub(count, std::memory_order_acq_rel);
     assert(previous >= count && "reference count should not go below zero");
     if (previous == count)
       destroy();
@@ -110,6 +110,11 @@ Operation *Operation::create(Location location, OperationName name,
   size_t prefixByteSize = llvm::alignTo(
       Operation::prefixAllocSize(numTrailingResults, numInlineResults),
       alignof(Operation));
+  // The operation, its results, operands, successors, regions and properties
+  // all come from this single allocation. Operations are not tied to an arena:
+  // they can be moved between blocks, regions and even functions at any time
+  // and are freed individually in destroy(), so a per-block or per-region
+  // allocator would need to track ownership across every such move.
   char *mallocMem = reinterpret_cast<char *>(malloc(byteSize + prefixByteSize));
   void *rawMem = mallocMem + prefixByteSize;
 
@@ -13,6 +13,7 @@
 #include "mlir/Parser/Parser.h"
 #include "mlir/AsmParser/AsmParser.h"
 #include "mlir/Bytecode/BytecodeReader.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/SourceMgr.h"
 
 using namespace mlir;
@@ -53,6 +54,47 @@ LogicalResult mlir::parseSourceFile(llvm::StringRef filename, Block *block,
   return parseSourceFile(filename, sourceMgr, block, config, sourceFileLoc);
 }
 
+/// Opens `filename`, or stdin for "-", with a null terminator only if the
+/// contents are not bytecode.
+static llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
+openSourceFile(llvm::StringRef filename) {
+  // Buffers read from stdin are always null terminated.
+  if (filename == "-")
+    return llvm::MemoryBuffer::getSTDIN();
+
+  llvm::Expected<llvm::sys::fs::file_t> fd =
+      llvm::sys::fs::openNativeFileForRead(filename);
+  if (!fd)
+    return llvm::errorToErrorCode(fd.takeError());
+
+  // The textual parser needs a null terminator, but bytecode does not, and
+  // requiring one prevents large files whose size is a multiple of the page
+  // size from being memory mapped. Keeping bytecode mapped lets the reader
+  // reference resource blobs in place instead of copying them. So peek at the
+  // magic number before mapping the file. Streams such as pipes can not be
+  // peeked at without consuming them, but they are always read into a null
+  // terminated buffer anyway.
+  bool requiresNullTerminator = true;
+  llvm::sys::fs::file_status status;
+  if (!llvm::sys::fs::status(*fd, status) &&
+      status.type() == llvm::sys::fs::file_type::regular_file) {
+    char magic[4];
+    llvm::Expected<size_t> magicSize =
+        llvm::sys::fs::readNativeFileSlice(*fd, magic, /*Offset=*/0);
+    if (!magicSize) {
+      llvm::sys::fs::closeFile(*fd);
+      return llvm::errorToErrorCode(magicSize.takeError());
+    }
+    requiresNullTerminator = !isBytecode(llvm::MemoryBufferRef(
+        llvm::StringRef(magic, *magicSize), filename));
+  }
+
+  auto fileOrErr = llvm::MemoryBuffer::getOpenFile(
+      *fd, filename, /*FileSize=*/-1, requiresNullTerminator);
+  llvm::sys::fs::closeFile(*fd);
+  return fileOrErr;
+}
+
 static LogicalResult loadSourceFileBuffer(llvm::StringRef filename,
                                           llvm::SourceMgr &sourceMgr,
                                           MLIRContext *ctx) {
@@ -61,7 +103,7 @@ static LogicalResult loadSourceFileBuffer(llvm::StringRef filename,
     return emitError(mlir::UnknownLoc::get(ctx),
                      "only main buffer parsed at the moment");
   }
-  auto fileOrErr = llvm::MemoryBuffer::getFileOrSTDIN(filename);
+  auto fileOrErr = openSourceFile(filename);
   if (fileOrErr.getError())
     return emitError(mlir::UnknownLoc::get(ctx),
                      "could not open input file " + filename);
@@ -130,7 +130,11 @@ LogicalResult PatternApplicator::matchAndRewrite(
     function_ref<LogicalResult(const Pattern &)> onSuccess) {
   // Before checking native patterns, first match against the bytecode. This
   // won't automatically perform any rewrites so there is no need to worry about
-  // conflicts.
+  // conflicts. The bytecode holds a single matcher for all PDL patterns, with
+  // their common predicates merged into one decision tree (see
+  // PDLToPDLInterp). Native patterns are only filtered by root operation and
+  // then tried one by one. Each attempt below runs as an ApplyPatternAction,
+  // which an action handler can observe to collect per-pattern statistics.
   SmallVector<PDLByteCode::MatchResult, 4> pdlMatches;
   const PDLByteCode *bytecode = frozenPatternList.getPDLByteCode();
   if (bytecode)
@@ -112,8 +112,11 @@ public:
   /// Initialize the storage uniquer with a given number of storage shards to
   /// use. The provided shard number is required to be a valid power of 2. The
   /// destructor function is used to destroy any allocated storage instances.
+  /// Shards are allocated lazily, so an unused shard only costs a pointer;
+  /// the default is sized so that heavily multithreaded pass pipelines that
+  /// miss in the thread local cache rarely contend on the same shard lock.
   ParametricStorageUniquer(function_ref<void(BaseStorage *)> destructorFn,
-                           size_t numShards = 8)
+                           size_t numShards = 32)
       : shards(new std::atomic<Shard *>[numShards]), numShards(numShards),
         destructorFn(destructorFn) {
     assert(llvm::isPowerOf2_64(numShards) &&
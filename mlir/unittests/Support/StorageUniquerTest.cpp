@@ -7,8 +7,11 @@
 //===----------------------------------------------------------------------===//
 
 #include "mlir/Support/StorageUniquer.h"
+#include "llvm/Config/llvm-config.h"
 #include "gmock/gmock.h"
 
+#include <thread>
+
 using namespace mlir;
 
 namespace {
@@ -58,3 +61,34 @@ TEST(StorageUniquerTest, NonTrivialDestructor) {
 
   EXPECT_TRUE(wasDestructed);
 }
+
+#if LLVM_ENABLE_THREADS
+TEST(StorageUniquerTest, ConcurrentGetOrCreate) {
+  struct IntStorage : public SimpleStorage<IntStorage, int> {
+    using Base::Base;
+  };
+
+  StorageUniquer uniquer;
+  uniquer.registerParametricStorageType<IntStorage>();
+
+  // Create the same set of instances from several threads at once, and verify
+  // that every thread observed the same uniqued instance for each key.
+  constexpr int kNumThreads = 16;
+  constexpr int kNumKeys = 1000;
+  std::vector<std::vector<IntStorage *>> results(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int key = 0; key < kNumKeys; ++key)
+        results[t].push_back(IntStorage::get(uniquer, key));
+    });
+  }
+  for (std::thread &thread : threads)
+    thread.join();
+
+  for (int t = 1; t < kNumThreads; ++t)
+    EXPECT_EQ(results[t], results[0]);
+  for (int key = 0; key < kNumKeys; ++key)
+    EXPECT_EQ(std::get<0>(results[0][key]->key), key);
+}
+#endif
@@ -2179,7 +2179,12 @@ struct AMDGPUDeviceTy : public GenericDeviceTy, AMDGenericDeviceTy {
       return Stream->pushPinnedMemoryCopyAsync(TgtPtr, PinnedPtr, Size);
     }
 
-    // For large transfers use synchronous behavior.
+    // For large transfers use synchronous behavior. This drains the stream,
+    // so the copy does not overlap with previously launched kernels. Buffers
+    // that are already pinned, e.g. with LIBOMPTARGET_LOCK_MAPPED_HOST_BUFFERS,
+    // take the asynchronous path above regardless of their size. Overlapping
+    // large unpinned copies would mean splitting them into chunks below
+    // OMPX_MaxAsyncCopyBytes, each staged through the pinned memory manager.
     if (Size >= OMPX_MaxAsyncCopyBytes) {
       if (AsyncInfoWrapper.hasQueue())
         if (auto Err = synchronize(AsyncInfoWrapper))
@@ -13,6 +13,7 @@
 #ifndef LLVM_OPENMP_LIBOMPTARGET_PLUGINS_COMMON_MEMORYMANAGER_MEMORYMANAGER_H
 #define LLVM_OPENMP_LIBOMPTARGET_PLUGINS_COMMON_MEMORYMANAGER_MEMORYMANAGER_H
 
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <list>
@@ -126,6 +127,12 @@ class MemoryManagerTy {
   /// The reference to a device allocator
   DeviceAllocatorTy &DeviceAllocator;
 
+  /// Number of managed allocations served from \p FreeLists and number of
+  /// those that had to go to the device, reported when the manager is
+  /// destroyed.
+  std::atomic<size_t> NumHits = 0;
+  std::atomic<size_t> NumMisses = 0;
+
   /// The threshold to manage memory using memory manager. If the request size
   /// is larger than \p SizeThreshold, the allocation will not be managed by the
   /// memory manager.
@@ -202,6 +209,9 @@ public:
 
   /// Destructor
   ~MemoryManagerTy() {
+    DP("MemoryManagerTy: %zu allocations reused cached memory, %zu went to "
+       "the device.\n",
+       NumHits.load(), NumMisses.load());
     for (auto Itr = PtrToNodeTable.begin(); Itr != PtrToNodeTable.end();
          ++Itr) {
       assert(Itr->second.Ptr && "nullptr in map table");
@@ -240,23 +250,30 @@ public:
       const int B = findBucket(Size);
       FreeListTy &List = FreeLists[B];
 
+      // Reuse the smallest node that fits instead of requiring an exact size
+      // match, otherwise mappings whose sizes differ slightly from one
+      // iteration to the next never hit the cache. The last bucket holds every
+      // size up to the threshold, so bound the waste to twice the request.
       NodeTy TempNode(Size, nullptr);
       std::lock_guard<std::mutex> LG(FreeListLocks[B]);
-      const auto Itr = List.find(TempNode);
+      const auto Itr = List.lower_bound(TempNode);
 
-      if (Itr != List.end()) {
+      if (Itr != List.end() && Itr->get().Size <= 2 * Size) {
         NodePtr = &Itr->get();
         List.erase(Itr);
       }
     }
 
-    if (NodePtr != nullptr)
+    if (NodePtr != nullptr) {
       DP("Find one node " DPxMOD " in the bucket.\n", DPxPTR(NodePtr));
+      ++NumHits;
+    }
 
     // We cannot find a valid node in FreeLists. Let's allocate on device and
     // create a node for it.
     if (NodePtr == nullptr) {
       DP("Cannot find a node in the FreeLists. Allocate on device.\n");
+      ++NumMisses;
       // Allocate one on device
       void *TgtPtr = allocateOrFreeAndAllocateOnDevice(Size, HstPtr);
 
@@ -82,6 +82,12 @@ kmp_uint32 __kmp_barrier_gather_bb_dflt = 2;
 kmp_uint32 __kmp_barrier_release_bb_dflt = 2;
 /* branch_factor = 4 */ /* hyper2: C78980 */
 
+// The default pattern does not depend on the team size. For large teams with
+// frequent, short parallel regions the distributed barrier (bp_dist_bar,
+// KMP_{PLAIN,FORKJOIN}_BARRIER_PATTERN=dist,dist) is usually cheaper: it sizes
+// its go/flag groups from the team size (distributedBarrier::computeGo) and
+// keeps every flag on its own cache lines. Waiting threads spin for
+// KMP_BLOCKTIME before they sleep in both cases.
 kmp_bar_pat_e __kmp_barrier_gather_pat_dflt = bp_hyper_bar;
 /* hyper2: C78980 */
 kmp_bar_pat_e __kmp_barrier_release_pat_dflt = bp_hyper_bar;
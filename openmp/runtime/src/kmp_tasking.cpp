@@ -3407,6 +3407,12 @@ static inline int __kmp_execute_tasks_template(
           asleep = 0;
         } else if (!new_victim) { // no recent steals and we haven't already
           // used a new victim; select a random thread
+          // Victims are chosen uniformly over the team, without regard to
+          // topology; only the td_deque_last_stolen reuse above keeps steals
+          // local. A locality-first policy would compare th_topology_ids of
+          // the two threads (e.g. the KMP_HW_SOCKET or KMP_HW_LLC entries,
+          // which are only meaningful when affinity is enabled) and try
+          // victims that share a socket or LLC with this thread first.
           do { // Find a different thread to steal work from.
             // Pick a random thread. Initial plan was to cycle through all the
             // threads, and only return if we tried to steal from every thread,
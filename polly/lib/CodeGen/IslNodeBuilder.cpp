@@ -617,6 +617,12 @@ void IslNodeBuilder::createForParallel(__isl_take isl_ast_node *For) {
 
   std::unique_ptr<ParallelLoopGenerator> ParallelLoopGenPtr;
 
+  // Both backends outline the loop body into a host subfunction and pass
+  // SubtreeValues to it by reference. Generating device code instead would be
+  // a further ParallelLoopGenerator that outlines a kernel through
+  // OpenMPIRBuilder's target region support. That generator would also need
+  // map clauses for every array in the subtree, sized from the bounds of its
+  // access relations rather than from SubtreeValues.
   switch (PollyOmpBackend) {
   case OpenMPBackend::GNU:
     ParallelLoopGenPtr.reset(
@@ -52,6 +52,7 @@
 #include "polly/MatmulOptimizer.h"
 #include "polly/Options.h"
 #include "polly/ScheduleTreeTransform.h"
+#include "polly/Support/GICHelper.h"
 #include "polly/Support/ISLOStream.h"
 #include "polly/Support/ISLTools.h"
 #include "llvm/ADT/Sequence.h"
@@ -86,6 +87,12 @@ static cl::opt<int> MaxConstantTerm(
     cl::desc("The maximal constant term allowed (-1 is unlimited)"), cl::Hidden,
     cl::init(20), cl::cat(PollyCategory));
 
+static cl::opt<int> ScheduleComputeOut(
+    "polly-schedule-computeout",
+    cl::desc("Bound the scheduler by a maximal amount of computational steps "
+             "(0 means no bound)"),
+    cl::Hidden, cl::init(300000), cl::ZeroOrMore, cl::cat(PollyCategory));
+
 static cl::opt<int> MaxCoefficient(
     "polly-opt-max-coefficient",
     cl::desc("The maximal coefficient allowed (-1 is unlimited)"), cl::Hidden,
@@ -193,6 +200,9 @@ static cl::opt<bool> OptimizedScops(
 STATISTIC(ScopsProcessed, "Number of scops processed");
 STATISTIC(ScopsRescheduled, "Number of scops rescheduled");
 STATISTIC(ScopsOptimized, "Number of scops optimized");
+STATISTIC(ScopsScheduleOutOfQuota,
+          "Number of scops whose rescheduling exceeded the max-operations "
+          "limit");
 
 STATISTIC(NumAffineLoopsOptimized, "Number of affine loops optimized");
 STATISTIC(NumBoxedLoopsOptimized, "Number of boxed loops optimized");
@@ -860,7 +870,15 @@ static void runIslScheduleOptimizer(
     SC = SC.set_proximity(Proximity);
     SC = SC.set_validity(Validity);
     SC = SC.set_coincidence(Validity);
-    Schedule = SC.compute_schedule();
+    {
+      IslMaxOperationsGuard MaxOpGuard(Ctx, ScheduleComputeOut);
+      Schedule = SC.compute_schedule();
+      if (MaxOpGuard.hasQuotaExceeded()) {
+        ScopsScheduleOutOfQuota++;
+        LLVM_DEBUG(dbgs()
+                   << "Schedule optimizer calculation exceeds ISL quota\n");
+      }
+    }
     isl_options_set_on_error(Ctx, OnErrorStatus);
 
     ScopsRescheduled++;